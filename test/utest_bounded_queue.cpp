@@ -0,0 +1,58 @@
+#include "bounded_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+using namespace vpd;
+
+TEST(BoundedQueueTest, PopInPushOrder)
+{
+    BoundedQueue<std::string> l_queue(3);
+
+    EXPECT_TRUE(l_queue.push("first"));
+    EXPECT_TRUE(l_queue.push("second"));
+    EXPECT_EQ(l_queue.size(), 2);
+
+    EXPECT_EQ(l_queue.pop(), "first");
+    EXPECT_EQ(l_queue.tryPop(), "second");
+    EXPECT_FALSE(l_queue.tryPop().has_value());
+    EXPECT_EQ(l_queue.getMaxDepth(), 2);
+}
+
+TEST(BoundedQueueTest, CloseDrainsPendingItems)
+{
+    BoundedQueue<int> l_queue(2);
+
+    EXPECT_TRUE(l_queue.push(1));
+    l_queue.close();
+
+    // Push fails once closed, items pushed before are still returned.
+    EXPECT_FALSE(l_queue.push(2));
+    EXPECT_EQ(l_queue.pop(), 1);
+    EXPECT_FALSE(l_queue.pop().has_value());
+}
+
+TEST(BoundedQueueTest, PushBlocksWhileFull)
+{
+    BoundedQueue<int> l_queue(1);
+
+    std::thread l_producer{[&l_queue]() {
+        for (int l_item = 0; l_item < 100; ++l_item)
+        {
+            l_queue.push(int{l_item});
+        }
+        l_queue.close();
+    }};
+
+    int l_expectedItem = 0;
+    while (auto l_item = l_queue.pop())
+    {
+        EXPECT_EQ(*l_item, l_expectedItem++);
+    }
+    l_producer.join();
+
+    EXPECT_EQ(l_expectedItem, 100);
+    EXPECT_EQ(l_queue.getMaxDepth(), 1);
+}
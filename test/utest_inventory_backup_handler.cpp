@@ -0,0 +1,229 @@
+#include "inventory_backup_handler.hpp"
+
+#include <stdlib.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+class InventoryBackupHandlerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::string l_template{std::filesystem::temp_directory_path() /
+                               "utest_inventory_XXXXXX"};
+        ASSERT_NE(mkdtemp(l_template.data()), nullptr);
+        m_testPath = l_template;
+
+        m_primaryPath = m_testPath / "phosphor-inventory-manager";
+        m_stagingPath = m_testPath / "phosphor-inventory-manager.restore";
+        m_backupPath = m_testPath / "backup";
+        m_backupInventoryPath =
+            m_backupPath /
+            std::filesystem::path(constants::pimPath).relative_path();
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(m_testPath);
+    }
+
+    // Creates a file with given content, along with its directories.
+    static void createFile(const std::filesystem::path& i_filePath,
+                           const std::string& i_content)
+    {
+        std::filesystem::create_directories(i_filePath.parent_path());
+        std::ofstream(i_filePath) << i_content;
+    }
+
+    // Reads content of a file.
+    static std::string readFile(const std::filesystem::path& i_filePath)
+    {
+        std::ifstream l_file(i_filePath);
+        return std::string(std::istreambuf_iterator<char>(l_file),
+                           std::istreambuf_iterator<char>());
+    }
+
+    // Wrappers of private APIs of the handler.
+    static void replacePrimaryData(const InventoryBackupHandler& i_handler,
+                                   const std::filesystem::path& i_dataPath)
+    {
+        i_handler.replaceInventoryPrimaryData(i_dataPath);
+    }
+
+    static bool validateBackupData(
+        const InventoryBackupHandler& i_handler,
+        std::vector<std::filesystem::path>& o_directories,
+        std::vector<std::filesystem::path>& o_files)
+    {
+        return i_handler.validateInventoryBackupData(o_directories, o_files);
+    }
+
+    static bool copyBackupFiles(
+        const InventoryBackupHandler& i_handler,
+        const std::vector<std::filesystem::path>& i_files,
+        const std::filesystem::path& i_destinationPath)
+    {
+        return i_handler.copyInventoryBackupFiles(i_files, i_destinationPath);
+    }
+
+    std::filesystem::path m_testPath;
+    std::filesystem::path m_primaryPath;
+    std::filesystem::path m_stagingPath;
+    std::filesystem::path m_backupPath;
+    std::filesystem::path m_backupInventoryPath;
+};
+
+TEST_F(InventoryBackupHandlerTest, ReplacePrimaryData)
+{
+    createFile(m_primaryPath / "system/chassis/motherboard/old", "old");
+    createFile(m_primaryPath / "system/chassis/motherboard/common", "old");
+    createFile(m_stagingPath / "system/chassis/motherboard/common", "new");
+    createFile(m_stagingPath / "system/chassis/motherboard/cpu0/new", "new");
+
+    InventoryBackupHandler l_handler("pim", m_primaryPath,
+                                     m_testPath / "backup");
+    replacePrimaryData(l_handler, m_stagingPath);
+
+    EXPECT_EQ(readFile(m_primaryPath / "system/chassis/motherboard/common"),
+              "new");
+    EXPECT_EQ(readFile(m_primaryPath / "system/chassis/motherboard/cpu0/new"),
+              "new");
+    EXPECT_FALSE(std::filesystem::exists(
+        m_primaryPath / "system/chassis/motherboard/old"));
+
+    // Old primary data is removed.
+    EXPECT_FALSE(std::filesystem::exists(m_stagingPath));
+}
+
+TEST_F(InventoryBackupHandlerTest, ReplaceMissingPrimaryData)
+{
+    createFile(m_stagingPath / "system/chassis/motherboard/new", "new");
+
+    InventoryBackupHandler l_handler("pim", m_primaryPath,
+                                     m_testPath / "backup");
+    replacePrimaryData(l_handler, m_stagingPath);
+
+    EXPECT_EQ(readFile(m_primaryPath / "system/chassis/motherboard/new"),
+              "new");
+    EXPECT_FALSE(std::filesystem::exists(m_stagingPath));
+}
+
+TEST_F(InventoryBackupHandlerTest, ReplaceWithMissingData)
+{
+    createFile(m_primaryPath / "system/chassis/motherboard/old", "old");
+
+    InventoryBackupHandler l_handler("pim", m_primaryPath,
+                                     m_testPath / "backup");
+    EXPECT_THROW(replacePrimaryData(l_handler, m_stagingPath),
+                 std::filesystem::filesystem_error);
+
+    // Primary data is left untouched.
+    EXPECT_EQ(readFile(m_primaryPath / "system/chassis/motherboard/old"),
+              "old");
+}
+
+TEST_F(InventoryBackupHandlerTest, ValidateBackupData)
+{
+    createFile(m_backupInventoryPath / "system/chassis/motherboard/vini",
+               "data");
+
+    InventoryBackupHandler l_handler("pim", m_primaryPath, m_backupPath);
+    std::vector<std::filesystem::path> l_directories;
+    std::vector<std::filesystem::path> l_files;
+    EXPECT_TRUE(validateBackupData(l_handler, l_directories, l_files));
+
+    const auto l_inventoryPath{
+        std::filesystem::path(constants::pimPath).relative_path()};
+    const std::vector<std::filesystem::path> l_expectedFiles{
+        l_inventoryPath / "system/chassis/motherboard/vini"};
+    EXPECT_EQ(l_files, l_expectedFiles);
+
+    // Parent directories are listed before their children.
+    ASSERT_FALSE(l_directories.empty());
+    EXPECT_EQ(l_directories.front(), *l_inventoryPath.begin());
+    EXPECT_EQ(l_directories.back(),
+              l_inventoryPath / "system/chassis/motherboard");
+}
+
+TEST_F(InventoryBackupHandlerTest, ValidateBackupDataWithSymlink)
+{
+    createFile(m_backupInventoryPath / "system/chassis/motherboard/vini",
+               "data");
+    createFile(m_testPath / "outside", "data");
+    std::filesystem::create_symlink(
+        m_testPath / "outside",
+        m_backupInventoryPath / "system/chassis/motherboard/link");
+
+    InventoryBackupHandler l_handler("pim", m_primaryPath, m_backupPath);
+    std::vector<std::filesystem::path> l_directories;
+    std::vector<std::filesystem::path> l_files;
+    EXPECT_FALSE(validateBackupData(l_handler, l_directories, l_files));
+}
+
+TEST_F(InventoryBackupHandlerTest, ValidateBackupDataWithEmptyFile)
+{
+    createFile(m_backupInventoryPath / "system/chassis/motherboard/vini",
+               "data");
+    createFile(m_backupInventoryPath / "system/chassis/motherboard/empty", "");
+
+    InventoryBackupHandler l_handler("pim", m_primaryPath, m_backupPath);
+    std::vector<std::filesystem::path> l_directories;
+    std::vector<std::filesystem::path> l_files;
+    EXPECT_FALSE(validateBackupData(l_handler, l_directories, l_files));
+}
+
+TEST_F(InventoryBackupHandlerTest, ValidateBackupDataOutOfInventory)
+{
+    createFile(m_backupInventoryPath / "system/chassis/motherboard/vini",
+               "data");
+
+    InventoryBackupHandler l_handler("pim", m_primaryPath, m_backupPath);
+    std::vector<std::filesystem::path> l_directories;
+    std::vector<std::filesystem::path> l_files;
+
+    // File on the way to inventory path, but not under it.
+    createFile(m_backupInventoryPath.parent_path() / "file", "data");
+    EXPECT_FALSE(validateBackupData(l_handler, l_directories, l_files));
+    std::filesystem::remove(m_backupInventoryPath.parent_path() / "file");
+
+    // Directory off the inventory path.
+    createFile(m_backupPath / "etc/passwd", "data");
+    EXPECT_FALSE(validateBackupData(l_handler, l_directories, l_files));
+}
+
+TEST_F(InventoryBackupHandlerTest, CopyBackupFiles)
+{
+    // More files than copy threads.
+    std::vector<std::filesystem::path> l_files;
+    for (size_t l_index = 0;
+         l_index < 4 * constants::INVENTORY_RESTORE_THREAD_COUNT; ++l_index)
+    {
+        const std::filesystem::path l_file{
+            "fru" + std::to_string(l_index % 3) + "/file" +
+            std::to_string(l_index)};
+        createFile(m_backupPath / l_file, std::to_string(l_index));
+        std::filesystem::create_directories(
+            (m_stagingPath / l_file).parent_path());
+        l_files.push_back(l_file);
+    }
+
+    InventoryBackupHandler l_handler("pim", m_primaryPath, m_backupPath);
+    EXPECT_TRUE(copyBackupFiles(l_handler, l_files, m_stagingPath));
+
+    for (size_t l_index = 0; l_index < l_files.size(); ++l_index)
+    {
+        EXPECT_EQ(readFile(m_stagingPath / l_files[l_index]),
+                  std::to_string(l_index));
+    }
+
+    // Copy fails if any of the files is missing.
+    l_files.emplace_back("fru0/missing");
+    EXPECT_FALSE(copyBackupFiles(l_handler, l_files, m_stagingPath));
+}
@@ -0,0 +1,68 @@
+#include "io_scheduler.hpp"
+
+#include <future>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using namespace vpd;
+
+TEST(IoSchedulerTest, GetBusId)
+{
+    IoScheduler l_ioScheduler(nlohmann::json{});
+
+    EXPECT_EQ(l_ioScheduler.getBusId("/sys/bus/i2c/drivers/at24/8-0050/eeprom"),
+              "i2c-8");
+    EXPECT_EQ(l_ioScheduler.getBusId("/sys/bus/spi/drivers/at25/spi12.0/eeprom"),
+              "spi-12");
+    EXPECT_EQ(l_ioScheduler.getBusId("vpd_files/ipz_system.dat"), "vpd_files");
+}
+
+TEST(IoSchedulerTest, ScheduledOrderInterleavesBuses)
+{
+    IoScheduler l_ioScheduler(nlohmann::json{});
+
+    const std::vector<std::string> l_eeproms{
+        "/sys/bus/i2c/drivers/at24/9-0050/eeprom",
+        "/sys/bus/i2c/drivers/at24/8-0050/eeprom",
+        "/sys/bus/i2c/drivers/at24/8-0051/eeprom",
+        "/sys/bus/i2c/drivers/at24/8-0052/eeprom",
+        "/sys/bus/i2c/drivers/at24/9-0051/eeprom"};
+
+    // Bus 8 has the most EEPROMs, hence scheduled first.
+    const std::vector<std::string> l_expectedOrder{
+        "/sys/bus/i2c/drivers/at24/8-0050/eeprom",
+        "/sys/bus/i2c/drivers/at24/9-0050/eeprom",
+        "/sys/bus/i2c/drivers/at24/8-0051/eeprom",
+        "/sys/bus/i2c/drivers/at24/9-0051/eeprom",
+        "/sys/bus/i2c/drivers/at24/8-0052/eeprom"};
+
+    EXPECT_EQ(l_ioScheduler.getScheduledOrder(l_eeproms), l_expectedOrder);
+}
+
+TEST(IoSchedulerTest, AbandonedIoFailsSlotOnBus)
+{
+    IoScheduler l_ioScheduler(nlohmann::json{}, 1);
+    const std::string l_eeprom{"/sys/bus/i2c/drivers/at24/8-0050/eeprom"};
+
+    auto l_ioSlot = l_ioScheduler.acquireIoSlot(l_eeprom);
+
+    // Waiter on the bus fails once the I/O holding the slot is abandoned.
+    auto l_waiter = std::async(std::launch::async, [&]() {
+        return l_ioScheduler.acquireIoSlot(
+            "/sys/bus/i2c/drivers/at24/8-0051/eeprom");
+    });
+
+    l_ioSlot->abandon();
+    EXPECT_THROW(l_waiter.get(), std::runtime_error);
+    EXPECT_EQ(l_ioScheduler.getAbandonedIoCount(), 1U);
+
+    // Other buses are not affected.
+    EXPECT_NO_THROW(
+        l_ioScheduler.acquireIoSlot("/sys/bus/i2c/drivers/at24/9-0050/eeprom"));
+
+    // Bus is usable again once the abandoned I/O returns.
+    l_ioSlot.reset();
+    EXPECT_EQ(l_ioScheduler.getAbandonedIoCount(), 0U);
+    EXPECT_NO_THROW(l_ioScheduler.acquireIoSlot(l_eeprom));
+}
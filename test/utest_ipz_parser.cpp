@@ -2,6 +2,7 @@
 #include "parser.hpp"
 
 #include <exception>
+#include <filesystem>
 
 #include <gtest/gtest.h>
 
@@ -61,6 +62,47 @@ TEST(IpzVpdParserTest, GoodTestCase)
     ASSERT_EQ(l_description, "SYSTEM");
 }
 
+TEST(IpzVpdParserTest, WriteMultipleKeywords)
+{
+    nlohmann::json l_json;
+    const std::string l_vpdFile("/tmp/ipz_system_write_keywords.dat");
+    std::filesystem::copy_file("vpd_files/ipz_system.dat", l_vpdFile,
+                               std::filesystem::copy_options::overwrite_existing);
+
+    {
+        vpd::Parser l_vpdParser(l_vpdFile, l_json);
+        auto l_parserInstance = l_vpdParser.getVpdParserInstance();
+
+        const vpd::types::ListOfWriteVpdParams l_paramsToWrite{
+            std::make_tuple("VINI", "SN",
+                            vpd::types::BinaryVector{'A', 'B', 'C', 'D'}),
+            std::make_tuple("VINI", "DR",
+                            vpd::types::BinaryVector{'N', 'E', 'W'}),
+            std::make_tuple("VSYS", "DR",
+                            vpd::types::BinaryVector{'M', 'O', 'D'})};
+
+        EXPECT_EQ(l_parserInstance->writeKeywordsOnHardware(l_paramsToWrite),
+                  10);
+
+        // Records other than VHDR/VTOC only can be written.
+        EXPECT_THROW(l_parserInstance->writeKeywordsOnHardware(
+                         {std::make_tuple("VHDR", "RT",
+                                          vpd::types::BinaryVector{'X'})}),
+                     std::exception);
+    }
+
+    vpd::Parser l_vpdParser(l_vpdFile, l_json);
+    auto l_parsedMap = l_vpdParser.parse();
+    auto l_ipzVpdMapPtr = std::get_if<vpd::types::IPZVpdMap>(&l_parsedMap);
+    ASSERT_NE(l_ipzVpdMapPtr, nullptr);
+
+    EXPECT_EQ(l_ipzVpdMapPtr->at("VINI").at("SN").substr(0, 4), "ABCD");
+    EXPECT_EQ(l_ipzVpdMapPtr->at("VINI").at("DR").substr(0, 3), "NEW");
+    EXPECT_EQ(l_ipzVpdMapPtr->at("VSYS").at("DR").substr(0, 3), "MOD");
+
+    std::filesystem::remove(l_vpdFile);
+}
+
 TEST(IpzVpdParserTest, VpdFileDoesNotExist)
 {
     // Vpd file does not exist
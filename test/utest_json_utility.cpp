@@ -64,3 +64,85 @@ TEST(IsFruPowerOffOnlyTest, NegativeTestCase)
 
     EXPECT_FALSE(l_result);
 }
+
+TEST(GetFruCollectionPriorityTest, PriorityFromTags)
+{
+    uint16_t l_errCode = 0;
+    const nlohmann::json l_parsedJson = nlohmann::json::parse(R"({
+        "frus": {
+            "/explicit": [{"collectionPriority": 7, "essentialFru": true}],
+            "/essential": [{"essentialFru": true, "powerOffOnly": true}],
+            "/powerOffOnly": [{"powerOffOnly": true}],
+            "/inherit": [{}, {"inherit": true}],
+            "/copyRecords": [{"copyRecords": ["VSYS"]}],
+            "/implicitInherit": [{}, {"embedded": true}],
+            "/ccin": [{}, {"ccin": ["2E2D"]}],
+            "/default": [{}],
+            "/outOfRange": [{"collectionPriority": 256}],
+            "/negative": [{"collectionPriority": -1}]
+        }
+    })");
+
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(l_parsedJson, "/explicit",
+                                                    l_errCode),
+              7);
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(l_parsedJson, "/essential",
+                                                    l_errCode),
+              constants::COLLECTION_PRIORITY_ESSENTIAL);
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(
+                  l_parsedJson, "/powerOffOnly", l_errCode),
+              constants::COLLECTION_PRIORITY_POWER_OFF_ONLY);
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(l_parsedJson, "/inherit",
+                                                    l_errCode),
+              constants::COLLECTION_PRIORITY_DEPENDENCY);
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(
+                  l_parsedJson, "/copyRecords", l_errCode),
+              constants::COLLECTION_PRIORITY_DEPENDENCY);
+
+    // Only an explicit "inherit": true makes a dependency.
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(
+                  l_parsedJson, "/implicitInherit", l_errCode),
+              constants::COLLECTION_PRIORITY_DEFAULT);
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(l_parsedJson, "/ccin",
+                                                    l_errCode),
+              constants::COLLECTION_PRIORITY_DEFAULT);
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(l_parsedJson, "/default",
+                                                    l_errCode),
+              constants::COLLECTION_PRIORITY_DEFAULT);
+    EXPECT_EQ(l_errCode, 0);
+
+    jsonUtility::getFruCollectionPriority(l_parsedJson, "/missing", l_errCode);
+    EXPECT_EQ(l_errCode, error_code::FRU_PATH_NOT_FOUND);
+
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(l_parsedJson, "/outOfRange",
+                                                    l_errCode),
+              constants::COLLECTION_PRIORITY_DEFAULT);
+    EXPECT_EQ(l_errCode, error_code::INVALID_JSON);
+
+    EXPECT_EQ(jsonUtility::getFruCollectionPriority(l_parsedJson, "/negative",
+                                                    l_errCode),
+              constants::COLLECTION_PRIORITY_DEFAULT);
+    EXPECT_EQ(l_errCode, error_code::INVALID_JSON);
+}
+
+TEST(GetEepromReadTimeoutTest, TimeoutFromTag)
+{
+    uint16_t l_errCode = 0;
+    const nlohmann::json l_parsedJson = nlohmann::json::parse(R"({
+        "frus": {
+            "/explicit": [{"readTimeoutMs": 500}],
+            "/default": [{}]
+        }
+    })");
+
+    EXPECT_EQ(
+        jsonUtility::getEepromReadTimeout(l_parsedJson, "/explicit", l_errCode),
+        std::chrono::milliseconds(500));
+    EXPECT_EQ(
+        jsonUtility::getEepromReadTimeout(l_parsedJson, "/default", l_errCode),
+        std::chrono::milliseconds(constants::EEPROM_READ_TIMEOUT_MS));
+    EXPECT_EQ(l_errCode, 0);
+
+    jsonUtility::getEepromReadTimeout(l_parsedJson, "/missing", l_errCode);
+    EXPECT_EQ(l_errCode, error_code::FRU_PATH_NOT_FOUND);
+}
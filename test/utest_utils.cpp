@@ -2,8 +2,18 @@
 
 #include <utility/vpd_specific_utility.hpp>
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -25,6 +35,111 @@ TEST(UtilsTest, TestValidValue)
     }
 }
 
+TEST(UtilsTest, ReadVpdWithTimeout)
+{
+    uint16_t l_errCode = 0;
+    std::string l_testDir =
+        std::filesystem::temp_directory_path() / "utest_read_vpd_XXXXXX";
+    ASSERT_NE(mkdtemp(l_testDir.data()), nullptr);
+
+    const std::string l_vpdFilePath = l_testDir + "/vpd";
+    const std::string l_blockingFilePath = l_testDir + "/fifo";
+
+    std::ofstream(l_vpdFilePath, std::ios::binary) << "VPD";
+
+    bool l_isReadOver = false;
+    types::BinaryVector l_vpdVector;
+    vpdSpecificUtility::getVpdDataInVectorWithTimeout(
+        l_vpdFilePath, l_vpdVector, 0, std::chrono::milliseconds(1000),
+        [&l_isReadOver]() { l_isReadOver = true; }, l_errCode);
+    EXPECT_EQ(l_errCode, 0);
+    EXPECT_EQ(l_vpdVector, (types::BinaryVector{'V', 'P', 'D'}));
+    EXPECT_TRUE(l_isReadOver);
+
+    // Open of a FIFO blocks till it has a writer, like a read on a wedged
+    // EEPROM.
+    ASSERT_EQ(mkfifo(l_blockingFilePath.c_str(), 0600), 0);
+
+    auto l_abandonedReadOver = std::make_shared<std::promise<void>>();
+    std::future<void> l_abandonedReadDone = l_abandonedReadOver->get_future();
+    vpdSpecificUtility::getVpdDataInVectorWithTimeout(
+        l_blockingFilePath, l_vpdVector, 0, std::chrono::milliseconds(100),
+        [l_abandonedReadOver]() { l_abandonedReadOver->set_value(); },
+        l_errCode);
+    EXPECT_EQ(l_errCode, error_code::EEPROM_READ_TIMEOUT);
+
+    // Opening the FIFO for write releases the abandoned reader, closing it
+    // without a write gives the reader an end of file.
+    const int l_fifoFd = open(l_blockingFilePath.c_str(), O_WRONLY);
+    ASSERT_GE(l_fifoFd, 0);
+    close(l_fifoFd);
+
+    EXPECT_EQ(l_abandonedReadDone.wait_for(std::chrono::seconds(5)),
+              std::future_status::ready);
+
+    std::filesystem::remove_all(l_testDir);
+}
+
+TEST(UtilsTest, PageAlignedWritesMergeInPage)
+{
+    // Ranges in one page are merged, with the unchanged bytes in between.
+    EXPECT_EQ(vpdSpecificUtility::getPageAlignedWrites(
+                  {{10, 2}, {2, 3}, {12, 1}}, 0, 16),
+              (std::vector<std::pair<size_t, size_t>>{{2, 11}}));
+
+    // Adjacent ranges in different pages are not merged.
+    EXPECT_EQ(vpdSpecificUtility::getPageAlignedWrites({{4, 4}, {8, 4}}, 0, 8),
+              (std::vector<std::pair<size_t, size_t>>{{4, 4}, {8, 4}}));
+
+    // Overlapping ranges are written once.
+    EXPECT_EQ(vpdSpecificUtility::getPageAlignedWrites({{1, 5}, {3, 2}}, 0, 8),
+              (std::vector<std::pair<size_t, size_t>>{{1, 5}}));
+}
+
+TEST(UtilsTest, PageAlignedWritesSplitOnPage)
+{
+    // Range crossing pages is split on page boundary.
+    EXPECT_EQ(
+        vpdSpecificUtility::getPageAlignedWrites({{6, 12}}, 0, 8),
+        (std::vector<std::pair<size_t, size_t>>{{6, 2}, {8, 8}, {16, 2}}));
+
+    // Pages are aligned on EEPROM offset, not on VPD offset.
+    EXPECT_EQ(vpdSpecificUtility::getPageAlignedWrites({{0, 8}, {9, 1}}, 4, 8),
+              (std::vector<std::pair<size_t, size_t>>{{0, 4}, {4, 6}}));
+
+    // Split part is merged with a later range of the same page.
+    EXPECT_EQ(vpdSpecificUtility::getPageAlignedWrites({{6, 4}, {14, 1}}, 0, 8),
+              (std::vector<std::pair<size_t, size_t>>{{6, 2}, {8, 7}}));
+
+    // Page size 0 is taken as byte writes.
+    EXPECT_EQ(vpdSpecificUtility::getPageAlignedWrites({{0, 2}}, 0, 0),
+              (std::vector<std::pair<size_t, size_t>>{{0, 1}, {1, 1}}));
+}
+
+TEST(UtilsTest, EepromWritePageSize)
+{
+    uint16_t l_errCode = 0;
+    const nlohmann::json l_sysCfgJson = nlohmann::json::parse(R"({
+        "frus": {
+            "/sys/bus/i2c/drivers/at24/8-0050/eeprom": [
+                { "inventoryPath": "/system/chassis", "writePageSize": 32 }
+            ]
+        }
+    })");
+
+    EXPECT_EQ(vpdSpecificUtility::getEepromWritePageSize(
+                  l_sysCfgJson, "/sys/bus/i2c/drivers/at24/8-0050/eeprom",
+                  l_errCode),
+              32);
+    EXPECT_EQ(l_errCode, 0);
+
+    // No tag and no device tree node.
+    EXPECT_EQ(vpdSpecificUtility::getEepromWritePageSize(
+                  l_sysCfgJson, "/tmp/no_such_dir/eeprom", l_errCode),
+              constants::EEPROM_WRITE_PAGE_SIZE);
+    EXPECT_EQ(l_errCode, 0);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
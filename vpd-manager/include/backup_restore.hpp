@@ -5,6 +5,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <memory>
 #include <tuple>
 
 namespace vpd
@@ -36,11 +37,13 @@ class BackupAndRestore
     /**
      * @brief Constructor.
      *
-     * @param[in] i_sysCfgJsonObj - System config JSON object.
+     * @param[in] i_sysCfgJsonObj - System config JSON object, shared and not
+     * copied.
      *
      * @throw std::runtime_error in case constructor failure.
      */
-    BackupAndRestore(const nlohmann::json& i_sysCfgJsonObj);
+    BackupAndRestore(
+        const std::shared_ptr<const nlohmann::json>& i_sysCfgJsonObj);
 
     /**
      * @brief Default destructor.
@@ -63,9 +66,17 @@ class BackupAndRestore
      * when source keyword has non default value but
      * destination's keyword has default value.
      *
+     * If source or destination is the EEPROM whose parsed VPD is passed, the
+     * passed VPD is used instead of parsing the EEPROM again.
+     *
+     * @param[in] i_parsedFruPath - EEPROM path of the parsed VPD, if any.
+     * @param[in] i_parsedVpdMap - Parsed VPD of the EEPROM, if any.
+     *
      * @return Tuple of updated source and destination VPD map variant.
      */
-    std::tuple<types::VPDMapVariant, types::VPDMapVariant> backupAndRestore();
+    std::tuple<types::VPDMapVariant, types::VPDMapVariant> backupAndRestore(
+        const std::string& i_parsedFruPath = std::string(),
+        const types::VPDMapVariant& i_parsedVpdMap = std::monostate{});
 
     /**
      * @brief An API to set backup and restore status.
@@ -99,6 +110,22 @@ class BackupAndRestore
         const std::string& i_fruPath,
         const types::WriteVpdParams& i_paramsToWriteData) const noexcept;
 
+    /**
+     * @brief An API to update list of keywords' value on primary or backup
+     * path.
+     *
+     * Same as updateKeywordOnPrimaryOrBackupPath, but all the keywords found
+     * in the backup and restore config JSON are updated in one go.
+     *
+     * @param[in] i_fruPath - EEPROM path of the FRU.
+     * @param[in] i_paramsToWriteData - List of input details.
+     *
+     * @return On success returns number of bytes written, -1 on failure.
+     */
+    int updateKeywordsOnPrimaryOrBackupPath(
+        const std::string& i_fruPath,
+        const types::ListOfWriteVpdParams& i_paramsToWriteData) const noexcept;
+
   private:
     /**
      * @brief An API to handle backup and restore of IPZ type VPD.
@@ -214,7 +241,7 @@ class BackupAndRestore
     bool isJsonValid();
 
     // System JSON config JSON object.
-    nlohmann::json m_sysCfgJsonObj{};
+    const std::shared_ptr<const nlohmann::json> m_sysCfgJsonObj;
 
     // Backup and restore config JSON object.
     nlohmann::json m_backupAndRestoreCfgJsonObj{};
@@ -5,6 +5,9 @@
 #include <sdbusplus/asio/connection.hpp>
 #include <sdbusplus/bus.hpp>
 
+#include <optional>
+#include <vector>
+
 namespace vpd
 {
 
@@ -76,126 +79,131 @@ class IbmBiosHandler : public BiosHandlerInterface
 
   private:
     /**
-     * @brief API to read given attribute from BIOS table.
-     *
-     * @param[in] attributeName - Attribute to be read.
-     * @return - Bios attribute current value.
+     * @brief Structure to map a BIOS attribute to the VSYS keyword backing it.
      */
-    types::BiosAttributeCurrentValue readBiosAttribute(
-        const std::string& attributeName);
+    struct BiosAttributeVpdMap
+    {
+        // BIOS attribute name.
+        const char* m_attributeName;
 
-    /**
-     * @brief API to process "hb_field_core_override" attribute.
-     *
-     * The API checks value stored in VPD. If found default then the BIOS value
-     * is saved to VPD else VPD value is restored in BIOS pending attribute
-     * table.
-     */
-    void processFieldCoreOverride();
+        // BIOS attribute type, used to set the attribute as pending.
+        const char* m_attributeType;
 
-    /**
-     * @brief API to save FCO data into VPD.
-     *
-     * @param[in] i_fcoInBios - FCO value.
-     */
-    void saveFcoToVpd(int64_t i_fcoInBios);
+        // VSYS keyword backing the attribute.
+        const char* m_keyword;
 
-    /**
-     * @brief API to save given value to "hb_field_core_override" attribute.
-     *
-     * @param[in] i_fcoVal - FCO value.
-     */
-    void saveFcoToBios(const types::BinaryVector& i_fcoVal);
+        // Minimum size of the keyword value.
+        size_t m_keywordSize;
 
-    /**
-     * @brief API to save AMM data into VPD.
-     *
-     * @param[in] i_memoryMirrorMode - Memory mirror mode value.
-     */
-    void saveAmmToVpd(const std::string& i_memoryMirrorMode);
+        // Bit of the keyword's first byte backing the attribute, 0 if the
+        // attribute is not backed by a bit.
+        uint8_t m_bitMask;
 
-    /**
-     * @brief API to save given value to "hb_memory_mirror_mode" attribute.
-     *
-     * @param[in] i_ammVal - AMM value.
-     */
-    void saveAmmToBios(const uint8_t& i_ammVal);
+        // Converts keyword value to BIOS value. Returns std::nullopt if the
+        // keyword holds default value, in which case BIOS value is backed up.
+        std::optional<types::BiosAttributePendingValue> (*m_vpdToBios)(
+            const types::BinaryVector& i_kwdValue, uint8_t i_bitMask);
 
-    /**
-     * @brief API to process "hb_memory_mirror_mode" attribute.
-     *
-     * The API checks value stored in VPD. If found default then the BIOS value
-     * is saved to VPD else VPD value is restored in BIOS pending attribute
-     * table.
-     */
-    void processActiveMemoryMirror();
+        // Applies BIOS value on keyword value. Returns false if BIOS value is
+        // invalid.
+        bool (*m_biosToVpd)(const types::BiosAttributePendingValue& i_biosValue,
+                            uint8_t i_bitMask,
+                            types::BinaryVector& io_kwdValue);
+    };
 
     /**
-     * @brief API to process "pvm_create_default_lpar" attribute.
+     * @brief API to get list of BIOS attributes backed up in VPD.
      *
-     * The API reads the value from VPD and restore it to the BIOS attribute
-     * in BIOS pending attribute table.
+     * @return List of BIOS attribute to VPD keyword mapping.
      */
-    void processCreateDefaultLpar();
+    static const std::vector<BiosAttributeVpdMap>& getBiosAttributeVpdMaps();
 
     /**
-     * @brief API to save given value to "pvm_create_default_lpar" attribute.
+     * @brief API to convert "RG" keyword value to "hb_field_core_override".
+     *
+     * @param[in] i_kwdValue - Keyword value.
+     * @param[in] i_bitMask - Unused.
      *
-     * @param[in] i_createDefaultLparVal - Value to be saved;
+     * @return BIOS value, std::nullopt if keyword has only ASCII spaces.
      */
-    void saveCreateDefaultLparToBios(const std::string& i_createDefaultLparVal);
+    static std::optional<types::BiosAttributePendingValue> fcoVpdToBios(
+        const types::BinaryVector& i_kwdValue, uint8_t i_bitMask);
 
     /**
-     * @brief API to save given value to VPD.
+     * @brief API to apply "hb_field_core_override" value on "RG" keyword.
      *
-     * @param[in] i_createDefaultLparVal - Value to be saved.
+     * @param[in] i_biosValue - BIOS value.
+     * @param[in] i_bitMask - Unused.
+     * @param[in,out] io_kwdValue - Keyword value.
      *
+     * @return true if applied, false if BIOS value is invalid.
      */
-    void saveCreateDefaultLparToVpd(const std::string& i_createDefaultLparVal);
+    static bool fcoBiosToVpd(
+        const types::BiosAttributePendingValue& i_biosValue, uint8_t i_bitMask,
+        types::BinaryVector& io_kwdValue);
 
     /**
-     * @brief API to process "pvm_clear_nvram" attribute.
+     * @brief API to convert "MM" keyword value to "hb_memory_mirror_mode".
      *
-     * The API reads the value from VPD and restores it to the BIOS pending
-     * attribute table.
-     */
-    void processClearNvram();
-
-    /**
-     * @brief API to save given value to "pvm_clear_nvram" attribute.
+     * @param[in] i_kwdValue - Keyword value.
+     * @param[in] i_bitMask - Unused.
      *
-     * @param[in] i_clearNvramVal - Value to be saved.
+     * @return BIOS value, std::nullopt if keyword has default value.
      */
-    void saveClearNvramToBios(const std::string& i_clearNvramVal);
+    static std::optional<types::BiosAttributePendingValue> ammVpdToBios(
+        const types::BinaryVector& i_kwdValue, uint8_t i_bitMask);
 
     /**
-     * @brief API to save given value to VPD.
+     * @brief API to apply "hb_memory_mirror_mode" value on "MM" keyword.
+     *
+     * @param[in] i_biosValue - BIOS value.
+     * @param[in] i_bitMask - Unused.
+     * @param[in,out] io_kwdValue - Keyword value.
      *
-     * @param[in] i_clearNvramVal - Value to be saved.
+     * @return true if applied, false if BIOS value is invalid.
      */
-    void saveClearNvramToVpd(const std::string& i_clearNvramVal);
+    static bool ammBiosToVpd(
+        const types::BiosAttributePendingValue& i_biosValue, uint8_t i_bitMask,
+        types::BinaryVector& io_kwdValue);
 
     /**
-     * @brief API to process "pvm_keep_and_clear" attribute.
+     * @brief API to convert a keyword bit to an enabled/disabled attribute.
      *
-     * The API reads the value from VPD and restore it to the BIOS pending
-     * attribute table.
+     * @param[in] i_kwdValue - Keyword value.
+     * @param[in] i_bitMask - Bit of the first byte backing the attribute.
+     *
+     * @return BIOS value.
      */
-    void processKeepAndClear();
+    static std::optional<types::BiosAttributePendingValue> bitVpdToBios(
+        const types::BinaryVector& i_kwdValue, uint8_t i_bitMask);
 
     /**
-     * @brief API to save given value to "pvm_keep_and_clear" attribute.
+     * @brief API to apply an enabled/disabled attribute on a keyword bit.
+     *
+     * @param[in] i_biosValue - BIOS value.
+     * @param[in] i_bitMask - Bit of the first byte backing the attribute.
+     * @param[in,out] io_kwdValue - Keyword value.
      *
-     * @param[in] i_KeepAndClearVal - Value to be saved.
+     * @return true if applied, false if BIOS value is invalid.
      */
-    void saveKeepAndClearToBios(const std::string& i_KeepAndClearVal);
+    static bool bitBiosToVpd(
+        const types::BiosAttributePendingValue& i_biosValue, uint8_t i_bitMask,
+        types::BinaryVector& io_kwdValue);
 
     /**
-     * @brief API to save given value to VPD.
+     * @brief API to sync BIOS attributes with the VPD keywords backing them.
+     *
+     * VSYS keywords are read once and diffed against all the mapped
+     * attributes in one pass. Changes to BIOS are set with a single pending
+     * attributes update and changes to VPD with a single keyword update.
      *
-     * @param[in] i_KeepAndClearVal - Value to be saved.
+     * @param[in] i_biosAttributeTable - BIOS attribute table.
+     * @param[in] i_isRestoreRequired - true to restore non default VPD values
+     * to BIOS, false to only back up BIOS values to VPD.
      */
-    void saveKeepAndClearToVpd(const std::string& i_KeepAndClearVal);
+    void syncBiosAttributes(
+        const types::BiosAttributeTable& i_biosAttributeTable,
+        bool i_isRestoreRequired);
 
     // const reference to shared pointer to Manager object.
     const std::shared_ptr<Manager>& m_manager;
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace vpd
+{
+/**
+ * @brief Class to implement a blocking queue of bounded capacity.
+ *
+ * Producers are blocked while the queue is full and consumers are blocked
+ * while the queue is empty, till the queue is closed. The queue is used to
+ * connect stages of a pipeline, so that a slow stage throttles the stage
+ * feeding it.
+ *
+ * @tparam T - Type of the items in the queue.
+ */
+template <typename T>
+class BoundedQueue
+{
+  public:
+    /**
+     * List of deleted methods.
+     */
+    BoundedQueue() = delete;
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+    BoundedQueue(BoundedQueue&&) = delete;
+    BoundedQueue& operator=(BoundedQueue&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_capacity - Maximum items the queue can hold, minimum 1.
+     */
+    explicit BoundedQueue(size_t i_capacity) :
+        m_capacity(std::max(i_capacity, size_t{1}))
+    {}
+
+    /**
+     * @brief Destructor.
+     */
+    ~BoundedQueue() = default;
+
+    /**
+     * @brief API to push an item to the queue.
+     *
+     * Blocks while the queue is full.
+     *
+     * @param[in] i_item - Item to push.
+     *
+     * @return true if item is pushed, false if queue is closed.
+     */
+    bool push(T&& i_item)
+    {
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        m_notFull.wait(l_lock, [this]() {
+            return m_isClosed || m_queue.size() < m_capacity;
+        });
+
+        if (m_isClosed)
+        {
+            return false;
+        }
+
+        m_queue.push_back(std::move(i_item));
+        m_maxDepth = std::max(m_maxDepth, m_queue.size());
+
+        l_lock.unlock();
+        m_notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief API to pop an item from the queue.
+     *
+     * Blocks while the queue is empty and not closed. Items pushed before the
+     * queue got closed are still returned.
+     *
+     * @return Item, std::nullopt if queue is closed and empty.
+     */
+    std::optional<T> pop()
+    {
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        m_notEmpty.wait(l_lock,
+                        [this]() { return m_isClosed || !m_queue.empty(); });
+
+        return popFront(l_lock);
+    }
+
+    /**
+     * @brief API to pop an item from the queue, without blocking.
+     *
+     * @return Item, std::nullopt if queue is empty.
+     */
+    std::optional<T> tryPop()
+    {
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        return popFront(l_lock);
+    }
+
+    /**
+     * @brief API to close the queue.
+     *
+     * Any further push fails and blocked producers and consumers are woken
+     * up.
+     */
+    void close()
+    {
+        {
+            std::scoped_lock l_lock(m_mutex);
+            m_isClosed = true;
+        }
+
+        m_notFull.notify_all();
+        m_notEmpty.notify_all();
+    }
+
+    /**
+     * @brief API to get the number of items in the queue.
+     *
+     * @return Number of items in the queue.
+     */
+    size_t size() const
+    {
+        std::scoped_lock l_lock(m_mutex);
+        return m_queue.size();
+    }
+
+    /**
+     * @brief API to get maximum number of items the queue held at any point.
+     *
+     * @return Maximum depth of the queue.
+     */
+    size_t getMaxDepth() const
+    {
+        std::scoped_lock l_lock(m_mutex);
+        return m_maxDepth;
+    }
+
+  private:
+    /**
+     * @brief API to pop front item of the queue.
+     *
+     * @param[in] i_lock - Lock held on m_mutex, released by the API.
+     *
+     * @return Item, std::nullopt if queue is empty.
+     */
+    std::optional<T> popFront(std::unique_lock<std::mutex>& i_lock)
+    {
+        if (m_queue.empty())
+        {
+            return std::nullopt;
+        }
+
+        std::optional<T> l_item{std::move(m_queue.front())};
+        m_queue.pop_front();
+
+        i_lock.unlock();
+        m_notFull.notify_one();
+        return l_item;
+    }
+
+    // Maximum items the queue can hold.
+    const size_t m_capacity;
+
+    // Items in the queue.
+    std::deque<T> m_queue;
+
+    // Maximum items the queue held at any point.
+    size_t m_maxDepth = 0;
+
+    // Holds if the queue is closed.
+    bool m_isClosed = false;
+
+    // Mutex to guard the queue.
+    mutable std::mutex m_mutex;
+
+    // To wait for space in the queue.
+    std::condition_variable m_notFull;
+
+    // To wait for an item in the queue.
+    std::condition_variable m_notEmpty;
+};
+} // namespace vpd
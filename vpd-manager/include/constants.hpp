@@ -171,6 +171,13 @@ constexpr auto hostInterface = "xyz.openbmc_project.State.Host";
 constexpr auto hostService = "xyz.openbmc_project.State.Host";
 constexpr auto hostRunningState =
     "xyz.openbmc_project.State.Host.HostState.Running";
+constexpr auto currentHostStateProperty = "CurrentHostState";
+constexpr auto chassisStateService = "xyz.openbmc_project.State.Chassis";
+constexpr auto chassisZeroStateObject = "/xyz/openbmc_project/state/chassis0";
+constexpr auto chassisStateInterface = "xyz.openbmc_project.State.Chassis";
+constexpr auto currentPowerStateProperty = "CurrentPowerState";
+constexpr auto chassisPowerOnState =
+    "xyz.openbmc_project.State.Chassis.PowerState.On";
 constexpr auto imageUpdateService = "xyz.openbmc_project.Software.BMC.Updater";
 constexpr auto imagePrirotyInf =
     "xyz.openbmc_project.Software.RedundancyPriority";
@@ -203,6 +210,59 @@ static constexpr auto STR_CMP_SUCCESS = 0;
 // Just a random value. Can be adjusted as required.
 static constexpr uint8_t MAX_THREADS = 10;
 
+// Maximum concurrent I/O on EEPROMs sitting on the same bus. Kernel serializes
+// transfers on a bus, so a second I/O would only queue behind the first.
+static constexpr size_t MAX_CONCURRENT_IO_PER_BUS = 1;
+
+// Priorities of FRU VPD collection, higher is collected first.
+static constexpr uint8_t COLLECTION_PRIORITY_DEFAULT = 0;
+static constexpr uint8_t COLLECTION_PRIORITY_DEPENDENCY = 1;
+static constexpr uint8_t COLLECTION_PRIORITY_POWER_OFF_ONLY = 2;
+static constexpr uint8_t COLLECTION_PRIORITY_ESSENTIAL = 3;
+
+// Threads parsing VPD and populating D-Bus data, in FRU collection pipeline.
+static constexpr size_t COLLECTION_PARSE_STAGE_THREADS = 2;
+
+// Maximum FRUs waiting between two stages of FRU collection pipeline.
+static constexpr size_t COLLECTION_STAGE_QUEUE_DEPTH = 8;
+
+// Maximum FRUs published on D-Bus with a single call to PIM.
+static constexpr size_t COLLECTION_PUBLISH_BATCH_SIZE = 16;
+
+// Maximum levels of cascaded muxes looked up to find bus of an EEPROM.
+static constexpr size_t MAX_MUX_DEPTH = 4;
+
+// Number of threads to execute D-Bus method calls served by VPD manager.
+static constexpr uint8_t DBUS_METHOD_THREAD_POOL_SIZE = 4;
+
+// Time to wait for VPD read on an EEPROM, unless given for the FRU in config
+// JSON. A full 64KB EEPROM read on a 100KHz I2C bus takes about 6 seconds.
+static constexpr uint32_t EEPROM_READ_TIMEOUT_MS = 30000;
+
+// Maximum EEPROM reads which can be abandoned on timeout and still be blocked,
+// each holding a thread and an open file.
+static constexpr size_t MAX_ABANDONED_EEPROM_READS = 4;
+
+// Write page size of VPD EEPROMs, used when neither the config JSON nor the
+// device tree gives it. Smallest page size among at24 parts with page writes.
+static constexpr size_t EEPROM_WRITE_PAGE_SIZE = 8;
+
+// Correlated property updates are sent once no update is queued for debounce
+// time, so that a burst of property changes is propagated once. A continuous
+// burst is still sent once the first queued update waits for max latency.
+static constexpr auto CORRELATED_PROP_UPDATE_DEBOUNCE_MS = 100;
+static constexpr auto CORRELATED_PROP_UPDATE_MAX_LATENCY_MS = 1000;
+
+// Retries of VPD collection of an EEPROM which failed collection. Delay before
+// a retry doubles on every retry, starting from base delay, up to max delay.
+static constexpr uint8_t FRU_COLLECTION_MAX_RETRIES = 5;
+static constexpr auto FRU_COLLECTION_RETRY_BASE_DELAY_SEC = 5;
+static constexpr auto FRU_COLLECTION_RETRY_MAX_DELAY_SEC = 120;
+
+// Retries of VPD collection of an EEPROM whose VPD failed to parse. VPD may
+// have been garbled on the bus, but bad VPD on the EEPROM won't get better.
+static constexpr uint8_t FRU_COLLECTION_MAX_DATA_ERROR_RETRIES = 1;
+
 static constexpr auto FAILURE = -1;
 static constexpr auto SUCCESS = 0;
 
@@ -221,6 +281,8 @@ static constexpr auto systemdService = "org.freedesktop.systemd1";
 static constexpr auto systemdObjectPath = "/org/freedesktop/systemd1";
 static constexpr auto systemdManagerInterface =
     "org.freedesktop.systemd1.Manager";
+static constexpr auto systemdUnitInterface = "org.freedesktop.systemd1.Unit";
+static constexpr auto systemdJobInterface = "org.freedesktop.systemd1.Job";
 
 static constexpr auto vpdCollectionInterface =
     "xyz.openbmc_project.Common.Progress";
@@ -246,8 +308,18 @@ static std::vector<uint8_t> rbmcPrototypeSystemImValue{
     55, 54, 48, 48, 50, 48, 48, 48};
 
 static constexpr auto fileModeDirectoryPath = "/var/lib/vpd/file";
+static constexpr auto collectionTraceFilePath =
+    "/var/lib/vpd/collection_trace.json";
 static constexpr auto pimBackupPath =
     "/var/lib/phosphor-data-sync/bmc_data_bkp/var/lib/phosphor-inventory-manager";
 static constexpr auto pimPrimaryPath = "/var/lib/phosphor-inventory-manager";
+
+// Number of threads copying inventory backup files in parallel.
+static constexpr size_t INVENTORY_RESTORE_THREAD_COUNT = 4;
+
+// Time to wait for a start, stop or restart of inventory manager service to
+// complete, and interval to check for its completion.
+static constexpr uint32_t INVENTORY_MANAGER_JOB_TIMEOUT_SEC = 60;
+static constexpr uint32_t INVENTORY_MANAGER_JOB_POLL_INTERVAL_MS = 200;
 } // namespace constants
 } // namespace vpd
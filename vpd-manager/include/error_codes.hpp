@@ -37,6 +37,7 @@ enum error_code
     INVALID_HEXADECIMAL_VALUE_LENGTH,
     INVALID_HEXADECIMAL_VALUE,
     INVALID_INVENTORY_PATH,
+    SERVICE_NOT_RUNNING,
 
     // VPD specific errors
     UNSUPPORTED_VPD_TYPE,
@@ -46,7 +47,8 @@ enum error_code
     RECEIVED_INVALID_KWD_TYPE_FROM_DBUS,
     INVALID_KEYWORD_LENGTH,
     INVALID_VALUE_READ_FROM_DBUS,
-    RECORD_NOT_FOUND
+    RECORD_NOT_FOUND,
+    EEPROM_READ_TIMEOUT
 };
 
 const std::unordered_map<int, std::string> errorCodeMap = {
@@ -84,6 +86,7 @@ const std::unordered_map<int, std::string> errorCodeMap = {
     {error_code::INVALID_KEYWORD_LENGTH, "Invalid keyword length."},
     {error_code::INVALID_VALUE_READ_FROM_DBUS, "Invalid value read from DBus"},
     {error_code::RECORD_NOT_FOUND, "Record not found."},
+    {error_code::EEPROM_READ_TIMEOUT, "EEPROM read did not complete in time."},
     {error_code::FAILED_TO_DETECT_LOCATION_CODE_TYPE,
      "Failed to detect location code type"},
     {error_code::DBUS_FAILURE, "Dbus call failed"},
@@ -93,5 +96,6 @@ const std::unordered_map<int, std::string> errorCodeMap = {
     {error_code::INVALID_HEXADECIMAL_VALUE_LENGTH,
      "Invalid hexadecimal value length."},
     {error_code::INVALID_HEXADECIMAL_VALUE, "Invalid hexadecimal value."},
-    {error_code::INVALID_INVENTORY_PATH, "Invalid inventory path."}};
+    {error_code::INVALID_INVENTORY_PATH, "Invalid inventory path."},
+    {error_code::SERVICE_NOT_RUNNING, "Service is not running."}};
 } // namespace vpd
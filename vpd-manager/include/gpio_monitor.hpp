@@ -115,14 +115,14 @@ class GpioMonitor
      *
      */
     GpioMonitor(
-        const nlohmann::json i_sysCfgJsonObj,
+        const std::shared_ptr<const nlohmann::json>& i_sysCfgJsonObj,
         const std::shared_ptr<Worker>& i_worker,
         const std::shared_ptr<boost::asio::io_context>& i_ioContext) noexcept :
         m_sysCfgJsonObj(i_sysCfgJsonObj)
     {
         try
         {
-            if (!m_sysCfgJsonObj.empty())
+            if (m_sysCfgJsonObj && !m_sysCfgJsonObj->empty())
             {
                 initHandlerForGpio(i_ioContext, i_worker);
             }
@@ -162,6 +162,7 @@ class GpioMonitor
     // Array of event handlers for all the attachable FRUs.
     std::vector<std::shared_ptr<GpioEventHandler>> m_gpioEventHandlerObjects;
 
-    const nlohmann::json& m_sysCfgJsonObj;
+    // System config JSON.
+    const std::shared_ptr<const nlohmann::json> m_sysCfgJsonObj;
 };
 } // namespace vpd
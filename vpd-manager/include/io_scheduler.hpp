@@ -0,0 +1,191 @@
+#pragma once
+
+#include "constants.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vpd
+{
+/**
+ * @brief Class to schedule I/O on EEPROMs based on the bus they sit on.
+ *
+ * EEPROMs sharing a bus, directly or through the channels of a mux, can't be
+ * accessed in parallel as the accesses are serialized by the kernel anyway.
+ * The class derives the bus of an EEPROM from its sysfs path and the "muxes"
+ * section of the system config JSON, limits the number of concurrent I/O on
+ * each bus and orders a list of EEPROMs so that all the buses are kept busy.
+ *
+ * An I/O which is given up on, while still blocked on the bus, is tracked as
+ * abandoned. No slot is given on a bus with an abandoned I/O till it returns,
+ * so that callers fail fast instead of waiting on a wedged bus.
+ */
+class IoScheduler
+{
+  public:
+    /**
+     * @brief RAII object holding an I/O slot on a bus.
+     *
+     * The slot is released on destruction.
+     */
+    class IoSlot
+    {
+      public:
+        IoSlot() = delete;
+        IoSlot(const IoSlot&) = delete;
+        IoSlot& operator=(const IoSlot&) = delete;
+        IoSlot(IoSlot&&) = delete;
+        IoSlot& operator=(IoSlot&&) = delete;
+
+        /**
+         * @brief Constructor.
+         *
+         * Blocks till a slot is available on the given bus.
+         *
+         * @param[in] i_scheduler - Scheduler to take the slot from.
+         * @param[in] i_busId - Bus on which slot is required.
+         *
+         * @throw std::runtime_error if the bus has an abandoned I/O.
+         */
+        IoSlot(IoScheduler& i_scheduler, const std::string& i_busId);
+
+        /**
+         * @brief Destructor.
+         */
+        ~IoSlot();
+
+        /**
+         * @brief API to mark the I/O done under the slot as abandoned.
+         *
+         * To be called when the I/O is given up on while still in progress.
+         * The slot must be held till the I/O returns, the bus is taken as
+         * wedged till then.
+         */
+        void abandon() noexcept;
+
+      private:
+        // Scheduler the slot belongs to.
+        IoScheduler& m_scheduler;
+
+        // Bus on which the slot is held.
+        const std::string m_busId;
+
+        // If the I/O done under the slot is abandoned. Guarded by scheduler's
+        // mutex.
+        bool m_isAbandoned = false;
+    };
+
+    IoScheduler(const IoScheduler&) = delete;
+    IoScheduler& operator=(const IoScheduler&) = delete;
+    IoScheduler(IoScheduler&&) = delete;
+    IoScheduler& operator=(IoScheduler&&) = delete;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] i_sysCfgJsonObj - System config JSON, can be empty.
+     * @param[in] i_maxIoPerBus - Maximum concurrent I/O allowed on a bus.
+     */
+    explicit IoScheduler(
+        const nlohmann::json& i_sysCfgJsonObj,
+        size_t i_maxIoPerBus = constants::MAX_CONCURRENT_IO_PER_BUS);
+
+    /**
+     * @brief Destructor.
+     */
+    ~IoScheduler() = default;
+
+    /**
+     * @brief API to get bus on which an EEPROM sits.
+     *
+     * For EEPROM behind a mux, bus of the mux is returned.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     *
+     * @return Bus identifier, EEPROM's parent directory if bus can't be
+     * derived.
+     */
+    std::string getBusId(const std::string& i_eepromPath) const noexcept;
+
+    /**
+     * @brief API to order EEPROMs to maximize I/O throughput across buses.
+     *
+     * EEPROMs are picked in round robin across buses, starting with the bus
+     * having the most EEPROMs. Relative order of EEPROMs on a bus is kept.
+     *
+     * @param[in] i_eepromPaths - List of EEPROM paths.
+     *
+     * @return Ordered list of EEPROM paths.
+     */
+    std::vector<std::string> getScheduledOrder(
+        const std::vector<std::string>& i_eepromPaths) const noexcept;
+
+    /**
+     * @brief API to acquire an I/O slot for an EEPROM.
+     *
+     * Blocks till a slot is available on the EEPROM's bus. Fails without
+     * waiting further if the bus has or gets an abandoned I/O.
+     *
+     * @param[in] i_eepromPath - EEPROM path.
+     *
+     * @throw std::runtime_error if the bus has an abandoned I/O.
+     *
+     * @return Slot, released when the object goes out of scope.
+     */
+    std::unique_ptr<IoSlot> acquireIoSlot(const std::string& i_eepromPath);
+
+    /**
+     * @brief API to get number of abandoned I/O, which are yet to return.
+     *
+     * @return Number of abandoned I/O across all the buses.
+     */
+    size_t getAbandonedIoCount() noexcept;
+
+  private:
+    /**
+     * @brief API to map bus of mux channels to bus of the mux.
+     *
+     * Channels of muxes listed in system config JSON are read from sysfs.
+     *
+     * @param[in] i_sysCfgJsonObj - System config JSON.
+     */
+    void mapMuxChannels(const nlohmann::json& i_sysCfgJsonObj) noexcept;
+
+    /**
+     * @brief API to get the bus of mux, a mux channel's bus belongs to.
+     *
+     * @param[in] i_busNumber - I2C bus number.
+     *
+     * @return Bus number of the mux, given bus number if it is not behind any
+     * mux.
+     */
+    std::string getRootI2cBus(const std::string& i_busNumber) const noexcept;
+
+    // Maximum concurrent I/O allowed on a bus.
+    const size_t m_maxIoPerBus;
+
+    // Map of mux channel's bus number to bus number of the mux.
+    std::unordered_map<std::string, std::string> m_muxChannelToBus;
+
+    // Map of bus to number of I/O in progress on it.
+    std::unordered_map<std::string, size_t> m_activeIoPerBus;
+
+    // Map of bus to number of abandoned I/O on it, which are yet to return.
+    std::unordered_map<std::string, size_t> m_abandonedIoPerBus;
+
+    // Number of abandoned I/O, which are yet to return.
+    size_t m_abandonedIoCount = 0;
+
+    // Mutex to guard I/O and abandoned I/O count of buses.
+    std::mutex m_mutex;
+
+    // To wait for a slot on a bus, notified on release or abandon of a slot.
+    std::condition_variable m_slotReleased;
+};
+} // namespace vpd
@@ -1,11 +1,14 @@
 #pragma once
 
+#include "constants.hpp"
 #include "logger.hpp"
 #include "parser_interface.hpp"
 #include "types.hpp"
 
 #include <fstream>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace vpd
 {
@@ -28,15 +31,18 @@ class IpzVpdParser : public ParserInterface
     /**
      * @brief Constructor.
      *
-     * @param[in] vpdVector - VPD data.
+     * @param[in,out] vpdVector - VPD data, updated with the bytes written on
+     * hardware. Must outlive the parser.
      * @param[in] vpdFilePath - Path to VPD EEPROM.
      * @param[in] vpdStartOffset - Offset from where VPD starts in the file.
      * Defaulted to 0.
+     * @param[in] writePageSize - Write page size of the EEPROM.
      */
-    IpzVpdParser(const types::BinaryVector& vpdVector,
-                 const std::string& vpdFilePath, size_t vpdStartOffset = 0) :
+    IpzVpdParser(types::BinaryVector& vpdVector,
+                 const std::string& vpdFilePath, size_t vpdStartOffset = 0,
+                 size_t writePageSize = constants::EEPROM_WRITE_PAGE_SIZE) :
         m_vpdVector(vpdVector), m_vpdFilePath(vpdFilePath),
-        m_vpdStartOffset(vpdStartOffset)
+        m_vpdStartOffset(vpdStartOffset), m_writePageSize(writePageSize)
     {
         try
         {
@@ -106,6 +112,26 @@ class IpzVpdParser : public ParserInterface
      */
     int writeKeywordOnHardware(const types::WriteVpdParams i_paramsToWriteData);
 
+    /**
+     * @brief API to write a list of keywords' value on hardware.
+     *
+     * All the keywords are set on a single copy of the VPD and ECC of each
+     * record touched is recomputed only once, after all of its keywords are
+     * set.
+     *
+     * @param[in] i_paramsToWriteData - List of data required to perform write.
+     *
+     * @throw sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument.
+     * @throw sdbusplus::xyz::openbmc_project::Common::Error::NotAllowed.
+     * @throw DataException
+     * @throw EccException
+     *
+     * @return On success returns total number of bytes written on hardware, On
+     * failure throws exception.
+     */
+    int writeKeywordsOnHardware(
+        const types::ListOfWriteVpdParams& i_paramsToWriteData);
+
   private:
     /**
      * @brief Check ECC of VPD header.
@@ -185,6 +211,24 @@ class IpzVpdParser : public ParserInterface
      */
     void processRecord(auto recordOffset);
 
+    /**
+     * @brief Get index of keywords of a record.
+     *
+     * On first call for a record, keywords of the record are parsed and
+     * their data offset and length are indexed. Subsequent calls return the
+     * indexed data.
+     *
+     * @param[in] i_recordName - Record's name
+     * @param[in] i_recordDataOffset - Record's offset value
+     *
+     * @throw DataException
+     *
+     * @return Index of keywords of the record.
+     */
+    const types::KeywordIndex& getKeywordIndex(
+        const types::Record& i_recordName,
+        const types::RecordOffset& i_recordDataOffset);
+
     /**
      * @brief Get keyword's value from record
      *
@@ -204,7 +248,9 @@ class IpzVpdParser : public ParserInterface
      * @brief Get record's details from VTOC's PT keyword value
      *
      * This API parses through VTOC's PT keyword value and returns the given
-     * record's offset, record's length, ECC offset and ECC length.
+     * record's offset, record's length, ECC offset and ECC length. VTOC's PT
+     * keyword is parsed only once, details of all the records are indexed for
+     * subsequent calls.
      *
      * @param[in] i_record - Record's name.
      * @param[in] i_vtocOffset - Offset to VTOC record
@@ -220,7 +266,8 @@ class IpzVpdParser : public ParserInterface
      * @brief API to update record's ECC
      *
      * This API is required to update the record's ECC based on the record's
-     * current data.
+     * current data. The changed ECC bytes are marked dirty, to be written on
+     * hardware by writeDirtyRanges.
      *
      * @param[in] i_recordDataOffset - Record's data offset
      * @param[in] i_recordDataLength - Record's data length
@@ -237,7 +284,39 @@ class IpzVpdParser : public ParserInterface
                          types::BinaryVector& io_vpdVector);
 
     /**
-     * @brief API to set record's keyword's value on hardware.
+     * @brief API to mark a range of VPD as to be written on hardware.
+     *
+     * The given range is compared against the VPD read from hardware and only
+     * the span of bytes which actually differ is tracked.
+     *
+     * @param[in] i_offset - Offset of the range in VPD.
+     * @param[in] i_length - Length of the range.
+     * @param[in] i_vpdVector - Updated VPD.
+     */
+    void markRangeDirty(size_t i_offset, size_t i_length,
+                        const types::BinaryVector& i_vpdVector);
+
+    /**
+     * @brief API to write the dirty ranges of VPD on hardware.
+     *
+     * Dirty ranges are aligned to EEPROM write pages, so that each page is
+     * written once and no write crosses a page. Each write is verified by
+     * reading back the bytes written and then applied to the held VPD. The
+     * list of dirty ranges is cleared.
+     *
+     * @param[in] i_vpdVector - Updated VPD.
+     *
+     * @throw DataException, std::ios_base::failure
+     *
+     * @return Number of bytes written on hardware.
+     */
+    size_t writeDirtyRanges(const types::BinaryVector& i_vpdVector);
+
+    /**
+     * @brief API to set record's keyword's value.
+     *
+     * The value is set on the given vector and the changed bytes are marked
+     * dirty, to be written on hardware by writeDirtyRanges.
      *
      * @param[in] i_recordName - Record name.
      * @param[in] i_keywordName - Keyword name.
@@ -270,8 +349,8 @@ class IpzVpdParser : public ParserInterface
     bool processInvalidRecords(
         const types::InvalidRecordList& i_invalidRecordList) const noexcept;
 
-    // Holds VPD data.
-    const types::BinaryVector& m_vpdVector;
+    // Holds VPD data, kept in sync with hardware on write.
+    types::BinaryVector& m_vpdVector;
 
     // stores parsed VPD data.
     types::IPZVpdMap m_parsedVPDMap{};
@@ -284,5 +363,18 @@ class IpzVpdParser : public ParserInterface
 
     // VPD start offset. Required for ECC correction.
     size_t m_vpdStartOffset = 0;
+
+    // Write page size of the EEPROM.
+    size_t m_writePageSize = constants::EEPROM_WRITE_PAGE_SIZE;
+
+    // List of (offset, length) of VPD changed but not yet written on hardware.
+    std::vector<std::pair<size_t, size_t>> m_dirtyRanges;
+
+    // Index of records from VTOC, built on first lookup of a record.
+    types::RecordIndex m_recordIndex;
+
+    // Index of keywords of a record, built on first lookup of a keyword in the
+    // record.
+    std::unordered_map<types::Record, types::KeywordIndex> m_keywordIndex;
 };
 } // namespace vpd
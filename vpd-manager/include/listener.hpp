@@ -2,12 +2,17 @@
 
 #include "constants.hpp"
 #include "types.hpp"
+#include "utility/dbus_utility.hpp"
 #include "worker.hpp"
 
+#include <boost/asio/steady_timer.hpp>
 #include <nlohmann/json.hpp>
 #include <sdbusplus/asio/object_server.hpp>
 
+#include <chrono>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace vpd
 {
@@ -41,9 +46,20 @@ class Listener
     /**
      * @brief API to register callback for Host state change.
      *
+     * Host state is also cached, to be read by dbusUtility::isHostRunning
+     * without a D-Bus call.
      */
     void registerHostStateChangeCallback() const noexcept;
 
+    /**
+     * @brief API to register callback for chassis power and BMC state change.
+     *
+     * Chassis power and BMC state are cached, to be read by
+     * dbusUtility::isChassisPowerOn and dbusUtility::isBMCReady without a
+     * D-Bus call.
+     */
+    void registerSystemStateChangeCallback() noexcept;
+
     /**
      * @brief API to register callback for "AssetTag" property change.
      */
@@ -53,7 +69,8 @@ class Listener
      * @brief API to register "Present" property change callback
      *
      * This API registers "Present" property change callback for FRUs for
-     * which "monitorPresence" is true in system config JSON.
+     * which "monitorPresence" is true in system config JSON. A single match
+     * is registered for the inventory namespace, for all such FRUs.
      */
     void registerPresenceChangeCallback() noexcept;
 
@@ -61,7 +78,8 @@ class Listener
      * @brief API to register callback for all correlated properties.
      *
      * This API registers properties changed callback for all the interfaces in
-     * given correlated properties JSON file.
+     * given correlated properties JSON file. The JSON is compiled into a table
+     * of correlated properties, looked up on every property change.
      *
      * @param[in] i_correlatedPropJsonFile - File path of correlated properties
      * JSON.
@@ -94,6 +112,15 @@ class Listener
      */
     void hostStateChangeCallBack(sdbusplus::message_t& i_msg) const noexcept;
 
+    /**
+     * @brief API to update cache of a system state on its property change.
+     *
+     * @param[in] i_state - System state.
+     * @param[in] i_msg - Callback message.
+     */
+    void systemStateChangeCallBack(dbusUtility::SystemState i_state,
+                                   sdbusplus::message_t& i_msg) const noexcept;
+
     /**
      * @brief Callback API to be triggered on "AssetTag" property change.
      *
@@ -116,11 +143,62 @@ class Listener
      */
     void correlatedPropChangedCallBack(sdbusplus::message_t& i_msg) noexcept;
 
+    /**
+     * @brief API to compile correlated properties JSON.
+     *
+     * Destinations of each {service, interface, property, object path} in the
+     * JSON are stored in a flat table, so that no JSON is walked on a property
+     * change. Destinations listed under "defaultInterfaces" are stored with
+     * empty object path, to be applied on the changed object path itself.
+     *
+     * @param[in] i_correlatedPropJson - Parsed correlated properties JSON.
+     *
+     * @throw std::exception
+     */
+    void compileCorrelatedProps(const nlohmann::json& i_correlatedPropJson);
+
+    /**
+     * @brief API to get key of correlated properties table.
+     *
+     * @param[in] i_serviceName - Service name.
+     * @param[in] i_interface - Interface name.
+     * @param[in] i_property - Property name.
+     * @param[in] i_objectPath - Object path.
+     *
+     * @return Key to the correlated properties table.
+     */
+    static std::string getCorrelatedPropKey(const std::string& i_serviceName,
+                                            const std::string& i_interface,
+                                            const std::string& i_property,
+                                            const std::string& i_objectPath);
+
+    /**
+     * @brief API to get service name of a connection.
+     *
+     * Service names are cached against connection ID. A connection not in
+     * cache is looked up over D-Bus and added to the cache.
+     *
+     * @param[in] i_connectionId - Unique name of the connection.
+     *
+     * @return Service name, empty string on failure.
+     */
+    std::string getServiceName(const std::string& i_connectionId) noexcept;
+
+    /**
+     * @brief Callback API to be triggered on owner change of a service.
+     *
+     * Cache of connection ID to service name is updated as per new owner of
+     * the service.
+     *
+     * @param[in] i_msg - Callback message.
+     */
+    void nameOwnerChangedCallBack(sdbusplus::message_t& i_msg) noexcept;
+
     /**
      * @brief API to get correlated properties for given property.
      *
      * For a given service name, object path, interface and property, this API
-     * uses parsed correlated properties JSON object and returns a list of
+     * uses compiled correlated properties table and returns a list of
      * correlated object path, interface and property. Correlated properties are
      * properties which are hosted under different interfaces with same or
      * different data type, but share the same data. Hence if the data of a
@@ -142,23 +220,33 @@ class Listener
         const std::string& i_interface, const std::string& i_property) const;
 
     /**
-     * @brief API to update a given correlated property
+     * @brief API to queue update of a given correlated property
      *
-     * This API updates a given correlated property on Dbus. For updates to
-     * properties on Phosphor Inventory Manager it uses Phosphor Inventory
-     * Manager's "Notify" API to update the given property.
+     * The value is converted as per type of the correlated property and is
+     * queued. Queued updates are sent on Dbus together once no update is
+     * queued for CORRELATED_PROP_UPDATE_DEBOUNCE_MS, or once the first of them
+     * is queued for CORRELATED_PROP_UPDATE_MAX_LATENCY_MS, whichever is
+     * earlier. Only the last value queued for a property is updated.
      *
      * @param[in] i_serviceName - Service name.
      * @param[in] i_corrProperty - Details of correlated property to update
      * @param[in] i_value - Property value
      *
-     * @return true, if correlated property was successfully updated, false
-     * otherwise.
+     * @return true, if correlated property update is queued, false otherwise.
      */
-    bool updateCorrelatedProperty(
+    bool queueCorrelatedPropertyUpdate(
         const std::string& i_serviceName,
         const types::DbusPropertyEntry& i_corrProperty,
-        const types::DbusVariantType& i_value) const noexcept;
+        const types::DbusVariantType& i_value) noexcept;
+
+    /**
+     * @brief API to update all the queued correlated properties.
+     *
+     * Updates to properties on Phosphor Inventory Manager are sent in a
+     * single call to its "Notify" API. Properties of other services are set
+     * through asynchronous calls, so that the event loop is not blocked.
+     */
+    void updateQueuedCorrelatedProperties() noexcept;
 
     // Shared pointer to worker class
     const std::shared_ptr<Worker>& m_worker;
@@ -166,13 +254,44 @@ class Listener
     // Shared pointer to bus connection.
     const std::shared_ptr<sdbusplus::asio::connection>& m_asioConnection;
 
-    // Map of inventory path to Present property match object
-    types::FruPresenceMatchObjectMap m_fruPresenceMatchObjectMap;
+    // Inventory paths of FRUs whose presence is monitored.
+    std::unordered_set<std::string> m_presenceMonitoredPaths;
+
+    // Present property match object, for all the monitored FRUs.
+    std::shared_ptr<sdbusplus::bus::match_t> m_fruPresenceMatch;
+
+    // Correlated properties, compiled from correlated properties JSON.
+    types::CorrelatedPropsMap m_correlatedPropsMap;
 
-    // Parsed correlated properties JSON.
-    nlohmann::json m_correlatedPropJson{};
+    // Map of connection ID to service name. Accessed only from the event
+    // loop, hence not guarded.
+    std::unordered_map<std::string, std::string> m_serviceNameMap;
+
+    // NameOwnerChanged match objects for services in correlated properties
+    // JSON.
+    std::vector<std::shared_ptr<sdbusplus::bus::match_t>>
+        m_nameOwnerMatchObjects;
+
+    // Correlated properties of PIM queued for update.
+    types::ObjectMap m_queuedPimUpdates;
+
+    // Map of service name to correlated properties queued for update.
+    std::map<std::string, std::map<types::DbusPropertyEntry,
+                                   types::DbusVariantType>>
+        m_queuedPropertyUpdates;
+
+    // Timer to update queued correlated properties.
+    boost::asio::steady_timer m_correlatedPropTimer;
+
+    // Time by which queued correlated properties must be updated, set when
+    // the first of them is queued.
+    std::chrono::steady_clock::time_point m_correlatedPropDeadline;
 
     // A map of {service name,{interface name,match object}}
     types::MatchObjectMap m_matchObjectMap;
+
+    // Match objects of system states cached.
+    std::vector<std::shared_ptr<sdbusplus::bus::match_t>>
+        m_systemStateMatchObjects;
 };
 } // namespace vpd
@@ -7,9 +7,18 @@
 #include "types.hpp"
 #include "worker.hpp"
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/spawn.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <oem-handler/ibm_handler.hpp>
 #include <sdbusplus/asio/object_server.hpp>
 
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+
 namespace vpd
 {
 /**
@@ -60,6 +69,8 @@ class Manager
      * To update Keyword type VPD, input parameter for writing should be in the
      * form of (Keyword, Value). Eg: ("PE", {0x01, 0x02, 0x03}).
      *
+     * Takes the VPD access mutex exclusively, caller must not hold it.
+     *
      * @param[in] i_vpdPath - Path (inventory object path/FRU EEPROM path).
      * @param[in] i_paramsToWriteData - Input details.
      *
@@ -69,6 +80,26 @@ class Manager
     int updateKeyword(const types::Path i_vpdPath,
                       const types::WriteVpdParams i_paramsToWriteData);
 
+    /**
+     * @brief Update list of keywords' value of a FRU.
+     *
+     * This API is used to update multiple keywords of a single FRU in one
+     * shot. The EEPROM is read once, ECC of every touched record is recomputed
+     * once, reboot guard is held once and DBus is updated with a single call.
+     * Each entry of the list follows the same format as accepted by
+     * updateKeyword API.
+     *
+     * Takes the VPD access mutex exclusively, caller must not hold it.
+     *
+     * @param[in] i_vpdPath - Path (inventory object path/FRU EEPROM path).
+     * @param[in] i_paramsToWriteData - List of input details.
+     *
+     * @return On success returns total number of bytes written, on failure
+     * returns -1.
+     */
+    int updateKeywords(const types::Path i_vpdPath,
+                       const types::ListOfWriteVpdParams i_paramsToWriteData);
+
     /**
      * @brief Update keyword value on hardware.
      *
@@ -123,9 +154,14 @@ class Manager
      * current state of the system matches with the state at which the FRU is
      * allowed for VPD recollection.
      *
+     * Collection status is checked on the IO context, which owns it, and the
+     * collection is then executed on the thread pool.
+     *
+     * @param[in] i_yield - Context of the calling coroutine.
      * @param[in] i_dbusObjPath - D-bus object path
      */
     void collectSingleFruVpd(
+        boost::asio::yield_context i_yield,
         const sdbusplus::message::object_path& i_dbusObjPath);
 
     /**
@@ -204,6 +240,10 @@ class Manager
      * @brief  Perform VPD recollection
      * This api will trigger parser to perform VPD recollection for FRUs that
      * can be replaced at standby.
+     *
+     * The API returns once recollection is launched. Collection status on the
+     * progress interface is "InProgress" till recollection is over, then
+     * "Completed", or "Failed" if any FRU failed recollection.
      */
     void performVpdRecollection();
 
@@ -223,6 +263,17 @@ class Manager
     std::tuple<std::string, uint16_t> getUnexpandedLocationCode(
         const std::string& i_expandedLocationCode);
 
+    /**
+     * @brief API to dump trace of VPD collection.
+     *
+     * Time spans of steps of the last VPD collection or recollection are
+     * dumped to constants::collectionTraceFilePath as Chrome trace event JSON,
+     * which can be loaded in chrome://tracing or Perfetto.
+     *
+     * @return true on success, false otherwise.
+     */
+    bool dumpCollectionTrace() const noexcept;
+
     /**
      * @brief API to collect all FRUs VPD.
      *
@@ -239,6 +290,87 @@ class Manager
     bool collectAllFruVpd() const noexcept;
 
   private:
+    /**
+     * @brief API to get system config JSON.
+     *
+     * @return System config JSON shared by worker, empty JSON if worker is not
+     * available.
+     */
+    inline std::shared_ptr<const nlohmann::json> getSysCfgJsonSnapshot() const
+    {
+        if (m_worker.get() != nullptr)
+        {
+            return m_worker->getSysCfgJsonObj();
+        }
+
+        return std::make_shared<const nlohmann::json>();
+    }
+
+    /**
+     * @brief API to execute a task on the thread pool.
+     *
+     * The calling coroutine is suspended till the task completes on the thread
+     * pool, leaving the IO context free to serve other requests meanwhile.
+     *
+     * @param[in] i_yield - Context of the calling coroutine.
+     * @param[in] i_task - Task to execute.
+     *
+     * @throw Rethrows any exception thrown by the task.
+     *
+     * @return Value returned by the task.
+     */
+    template <typename Task>
+    auto executeOnThreadPool(boost::asio::yield_context i_yield, Task&& i_task)
+    {
+        using ResultType = std::invoke_result_t<Task>;
+
+        // Coroutine's stack outlives the task, so result can be held here.
+        std::exception_ptr l_exception;
+        std::conditional_t<std::is_void_v<ResultType>, bool,
+                           std::optional<ResultType>>
+            l_result{};
+
+        boost::asio::async_initiate<boost::asio::yield_context, void()>(
+            [this, &i_task, &l_result, &l_exception](auto i_handler) {
+                boost::asio::post(m_threadPool, [&i_task, &l_result,
+                                                 &l_exception,
+                                                 l_handler = std::move(
+                                                     i_handler)]() mutable {
+                    try
+                    {
+                        if constexpr (std::is_void_v<ResultType>)
+                        {
+                            i_task();
+                        }
+                        else
+                        {
+                            l_result.emplace(i_task());
+                        }
+                    }
+                    catch (...)
+                    {
+                        l_exception = std::current_exception();
+                    }
+
+                    // Resume the coroutine on its own executor.
+                    auto l_executor =
+                        boost::asio::get_associated_executor(l_handler);
+                    boost::asio::post(l_executor, std::move(l_handler));
+                });
+            },
+            i_yield);
+
+        if (l_exception)
+        {
+            std::rethrow_exception(l_exception);
+        }
+
+        if constexpr (!std::is_void_v<ResultType>)
+        {
+            return std::move(*l_result);
+        }
+    }
+
     /**
      * @brief An api to check validity of unexpanded location code.
      *
@@ -289,6 +421,16 @@ class Manager
 
     // Shared pointer to logger class.
     std::shared_ptr<Logger> m_logger;
+
+    // Mutex to guard VPD and FRU state against D-Bus method calls executing
+    // in parallel, shared with the other modules accessing VPD. Refer
+    // Worker::getVpdAccessMutex.
+    std::shared_mutex& m_vpdAccessMutex = Worker::getVpdAccessMutex();
+
+    // Thread pool to execute D-Bus method calls. Declared last, so that it is
+    // joined before any other member is destroyed.
+    boost::asio::thread_pool m_threadPool{
+        constants::DBUS_METHOD_THREAD_POOL_SIZE};
 };
 
 } // namespace vpd
@@ -0,0 +1,368 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace vpd
+{
+/**
+ * @brief Counters maintained by vpd-manager.
+ */
+enum class Counter : size_t
+{
+    EepromReads,
+    EepromReadFailures,
+    EepromReadTimeouts,
+    EepromBytesRead,
+    EccCorrections,
+    EccFailures,
+    KeywordIndexHits,
+    KeywordIndexMisses,
+    PimNotifyCalls,
+    PimNotifyFailures,
+    FrusCollected,
+    FrusCollectionFailed,
+    FruCollectionRetries,
+    Count
+};
+
+/**
+ * @brief Histograms maintained by vpd-manager.
+ *
+ * Latencies are in microseconds.
+ */
+enum class Histogram : size_t
+{
+    IpzParseLatency,
+    KeywordParseLatency,
+    DdimmParseLatency,
+    IsdimmParseLatency,
+    PimNotifyLatency,
+    PimNotifyBatchSize,
+    ReadKeywordLatency,
+    UpdateKeywordLatency,
+    Count
+};
+
+/**
+ * @brief Gauges maintained by vpd-manager.
+ */
+enum class Gauge : size_t
+{
+    ParseQueueMaxDepth,
+    PublishQueueMaxDepth,
+    Count
+};
+
+/**
+ * @brief Class to maintain runtime metrics of vpd-manager.
+ *
+ * Counters, histograms and gauges are updated with atomics, without taking
+ * any lock. Only the per bus EEPROM read count and per EEPROM retry count take
+ * a lock, as the buses and EEPROMs are known at runtime.
+ */
+class Metrics
+{
+  public:
+    /**
+     * List of deleted methods.
+     */
+    Metrics(const Metrics&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+    Metrics(Metrics&&) = delete;
+    Metrics& operator=(Metrics&&) = delete;
+
+    /**
+     * @brief Method to get instance of Metrics class.
+     */
+    static Metrics& getMetricsInstance()
+    {
+        static Metrics l_metrics;
+        return l_metrics;
+    }
+
+    /**
+     * @brief API to increment a counter.
+     *
+     * @param[in] i_counter - Counter to increment.
+     * @param[in] i_value - Value to increment by.
+     */
+    void increment(Counter i_counter, uint64_t i_value = 1) noexcept
+    {
+        m_counters[static_cast<size_t>(i_counter)].fetch_add(
+            i_value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to record a value in a histogram.
+     *
+     * @param[in] i_histogram - Histogram to record the value in.
+     * @param[in] i_value - Value to record.
+     */
+    void observe(Histogram i_histogram, uint64_t i_value) noexcept
+    {
+        HistogramData& l_histogram =
+            m_histograms[static_cast<size_t>(i_histogram)];
+
+        // Bucket n holds values in range [2^(n-1), 2^n).
+        const size_t l_bucket =
+            std::min<size_t>(std::bit_width(i_value), HISTOGRAM_BUCKETS - 1);
+
+        l_histogram.m_buckets[l_bucket].fetch_add(1, std::memory_order_relaxed);
+        l_histogram.m_count.fetch_add(1, std::memory_order_relaxed);
+        l_histogram.m_sum.fetch_add(i_value, std::memory_order_relaxed);
+
+        uint64_t l_max = l_histogram.m_max.load(std::memory_order_relaxed);
+        while (l_max < i_value)
+        {
+            if (l_histogram.m_max.compare_exchange_weak(
+                    l_max, i_value, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief API to set a gauge.
+     *
+     * @param[in] i_gauge - Gauge to set.
+     * @param[in] i_value - Value of the gauge.
+     */
+    void setGauge(Gauge i_gauge, uint64_t i_value) noexcept
+    {
+        m_gauges[static_cast<size_t>(i_gauge)].store(
+            i_value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to increment EEPROM read count of a bus.
+     *
+     * @param[in] i_busId - Bus on which EEPROM is read.
+     */
+    void incrementBusReads(const std::string& i_busId) noexcept
+    {
+        try
+        {
+            std::scoped_lock l_lock(m_busReadsMutex);
+            ++m_busReads[i_busId];
+        }
+        catch (const std::exception& l_ex)
+        {
+            // Read is left uncounted.
+        }
+    }
+
+    /**
+     * @brief API to increment VPD collection retry count of an EEPROM.
+     *
+     * @param[in] i_eepromPath - EEPROM for which collection is retried.
+     */
+    void incrementEepromRetries(const std::string& i_eepromPath) noexcept
+    {
+        increment(Counter::FruCollectionRetries);
+
+        try
+        {
+            std::scoped_lock l_lock(m_eepromRetriesMutex);
+            ++m_eepromRetries[i_eepromPath];
+        }
+        catch (const std::exception& l_ex)
+        {
+            // Retry is left uncounted for the EEPROM.
+        }
+    }
+
+    /**
+     * @brief API to get all the metrics in JSON format.
+     *
+     * @return Metrics in JSON.
+     */
+    nlohmann::json toJson() const
+    {
+        nlohmann::json l_metrics{{"counters", nlohmann::json::object()},
+                                 {"histograms", nlohmann::json::object()},
+                                 {"gauges", nlohmann::json::object()}};
+
+        for (size_t l_index = 0; l_index < m_counters.size(); ++l_index)
+        {
+            l_metrics["counters"][COUNTER_NAMES[l_index]] =
+                m_counters[l_index].load(std::memory_order_relaxed);
+        }
+
+        for (size_t l_index = 0; l_index < m_histograms.size(); ++l_index)
+        {
+            const HistogramData& l_histogram = m_histograms[l_index];
+
+            nlohmann::json l_buckets = nlohmann::json::object();
+            for (size_t l_bucket = 0; l_bucket < HISTOGRAM_BUCKETS; ++l_bucket)
+            {
+                const uint64_t l_count =
+                    l_histogram.m_buckets[l_bucket].load(
+                        std::memory_order_relaxed);
+                if (l_count == 0)
+                {
+                    continue;
+                }
+
+                const std::string l_upperBound =
+                    (l_bucket == HISTOGRAM_BUCKETS - 1)
+                        ? "inf"
+                        : std::to_string(uint64_t{1} << l_bucket);
+                l_buckets["lt_" + l_upperBound] = l_count;
+            }
+
+            l_metrics["histograms"][HISTOGRAM_NAMES[l_index]] = {
+                {"count", l_histogram.m_count.load(std::memory_order_relaxed)},
+                {"sum", l_histogram.m_sum.load(std::memory_order_relaxed)},
+                {"max", l_histogram.m_max.load(std::memory_order_relaxed)},
+                {"buckets", l_buckets}};
+        }
+
+        for (size_t l_index = 0; l_index < m_gauges.size(); ++l_index)
+        {
+            l_metrics["gauges"][GAUGE_NAMES[l_index]] =
+                m_gauges[l_index].load(std::memory_order_relaxed);
+        }
+
+        {
+            std::scoped_lock l_lock(m_busReadsMutex);
+            l_metrics["eepromReadsPerBus"] = m_busReads;
+        }
+
+        std::scoped_lock l_lock(m_eepromRetriesMutex);
+        l_metrics["collectionRetriesPerEeprom"] = m_eepromRetries;
+
+        return l_metrics;
+    }
+
+  private:
+    /**
+     * @brief Constructor
+     */
+    Metrics() = default;
+
+    // Number of buckets in a histogram.
+    static constexpr size_t HISTOGRAM_BUCKETS = 26;
+
+    /**
+     * @brief Structure of histogram data.
+     */
+    struct HistogramData
+    {
+        std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> m_buckets{};
+        std::atomic<uint64_t> m_count{0};
+        std::atomic<uint64_t> m_sum{0};
+        std::atomic<uint64_t> m_max{0};
+    };
+
+    // Names of the counters, in order of Counter enum.
+    static constexpr std::array<const char*,
+                                static_cast<size_t>(Counter::Count)>
+        COUNTER_NAMES{"eepromReads",
+                      "eepromReadFailures",
+                      "eepromReadTimeouts",
+                      "eepromBytesRead",
+                      "eccCorrections",
+                      "eccFailures",
+                      "keywordIndexHits",
+                      "keywordIndexMisses",
+                      "pimNotifyCalls",
+                      "pimNotifyFailures",
+                      "frusCollected",
+                      "frusCollectionFailed",
+                      "fruCollectionRetries"};
+
+    // Names of the histograms, in order of Histogram enum.
+    static constexpr std::array<const char*,
+                                static_cast<size_t>(Histogram::Count)>
+        HISTOGRAM_NAMES{"ipzParseLatencyUs",
+                        "keywordParseLatencyUs",
+                        "ddimmParseLatencyUs",
+                        "isdimmParseLatencyUs",
+                        "pimNotifyLatencyUs",
+                        "pimNotifyBatchSize",
+                        "readKeywordLatencyUs",
+                        "updateKeywordLatencyUs"};
+
+    // Names of the gauges, in order of Gauge enum.
+    static constexpr std::array<const char*, static_cast<size_t>(Gauge::Count)>
+        GAUGE_NAMES{"parseQueueMaxDepth", "publishQueueMaxDepth"};
+
+    // Counters.
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(Counter::Count)>
+        m_counters{};
+
+    // Histograms.
+    std::array<HistogramData, static_cast<size_t>(Histogram::Count)>
+        m_histograms{};
+
+    // Gauges.
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(Gauge::Count)>
+        m_gauges{};
+
+    // Map of bus to number of EEPROM reads on it.
+    std::unordered_map<std::string, uint64_t> m_busReads;
+
+    // Mutex to guard m_busReads.
+    mutable std::mutex m_busReadsMutex;
+
+    // Map of EEPROM to number of retries of its VPD collection.
+    std::unordered_map<std::string, uint64_t> m_eepromRetries;
+
+    // Mutex to guard m_eepromRetries.
+    mutable std::mutex m_eepromRetriesMutex;
+};
+
+/**
+ * @brief RAII object recording the time from its construction till
+ * destruction, in microseconds, in a histogram.
+ */
+class ScopedLatency
+{
+  public:
+    /**
+     * List of deleted methods.
+     */
+    ScopedLatency() = delete;
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+    ScopedLatency(ScopedLatency&&) = delete;
+    ScopedLatency& operator=(ScopedLatency&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] i_histogram - Histogram to record the latency in.
+     */
+    explicit ScopedLatency(Histogram i_histogram) : m_histogram(i_histogram) {}
+
+    /**
+     * @brief Destructor, records the latency.
+     */
+    ~ScopedLatency()
+    {
+        Metrics::getMetricsInstance().observe(
+            m_histogram,
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - m_startTime)
+                .count());
+    }
+
+  private:
+    // Histogram to record the latency in.
+    const Histogram m_histogram;
+
+    // Start time.
+    const std::chrono::steady_clock::time_point m_startTime{
+        std::chrono::steady_clock::now()};
+};
+} // namespace vpd
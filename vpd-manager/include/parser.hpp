@@ -1,14 +1,18 @@
 #pragma once
 
+#include "constants.hpp"
 #include "parser_factory.hpp"
 #include "parser_interface.hpp"
 #include "types.hpp"
+#include "vpd_cache.hpp"
 
 #include <string.h>
 
 #include <nlohmann/json.hpp>
 
+#include <future>
 #include <iostream>
+#include <utility>
 
 namespace vpd
 {
@@ -24,10 +28,25 @@ class Parser
     /**
      * @brief Constructor
      *
+     * Parsed JSON is shared with the caller and held till the object is
+     * destroyed, so JSON replaced in the meantime doesn't affect the object.
+     *
+     * @param[in] vpdFilePath - Path to the VPD file.
+     * @param[in] i_sysCfgJsonObj - Parsed system config JSON, can be null.
+     */
+    Parser(const std::string& vpdFilePath,
+           std::shared_ptr<const nlohmann::json> i_sysCfgJsonObj);
+
+    /**
+     * @brief Constructor
+     *
+     * Note: Parsed JSON is copied, use the constructor sharing the JSON to
+     * avoid copy of system config JSON.
+     *
      * @param[in] vpdFilePath - Path to the VPD file.
      * @param[in] parsedJson - Parsed JSON.
      */
-    Parser(const std::string& vpdFilePath, nlohmann::json parsedJson);
+    Parser(const std::string& vpdFilePath, const nlohmann::json& parsedJson);
 
     /**
      * @brief API to implement a generic parsing logic.
@@ -49,6 +68,27 @@ class Parser
      */
     std::shared_ptr<vpd::ParserInterface> getVpdParserInstance();
 
+    /**
+     * @brief API to execute an operation on cached VPD of the VPD file.
+     *
+     * Keyword reads and writes must go through this API, so that the VPD and
+     * the indices built on it are reused across calls. Refer VpdCache.
+     *
+     * @param[in] i_operation - Operation taking the parser of VPD.
+     *
+     * @throw Exception thrown while reading or parsing VPD, or by the
+     * operation.
+     *
+     * @return Value returned by the operation.
+     */
+    template <typename Operation>
+    auto executeOnCachedVpd(Operation&& i_operation)
+    {
+        return VpdCache::getVpdCacheInstance().execute(
+            m_vpdFilePath, m_vpdStartOffset, m_writePageSize,
+            std::forward<Operation>(i_operation));
+    }
+
     /**
      * @brief Update keyword value.
      *
@@ -74,7 +114,8 @@ class Parser
      *
      * This API is used to update keyword value on the EEPROM path and its
      * redundant path(s) if any taken from system config JSON. And also updates
-     * keyword value on DBus.
+     * keyword value on DBus. The update is done through updateVpdKeywords
+     * with a list of one keyword.
      *
      * To update IPZ type VPD, input parameter for writing should be in the form
      * of (Record, Keyword, Value). Eg: ("VINI", "SN", {0x01, 0x02, 0x03}).
@@ -83,8 +124,8 @@ class Parser
      * form of (Keyword, Value). Eg: ("PE", {0x01, 0x02, 0x03}).
      *
      * @param[in] i_paramsToWriteData - Input details.
-     * @param[in] o_updatedValue - Actual value which has been updated on
-     * hardware.
+     * @param[out] o_updatedValue - Value of the keyword after the update, as
+     * verified on hardware by read back of the write.
      *
      * @return On success returns number of bytes written, on failure returns
      * -1.
@@ -92,6 +133,32 @@ class Parser
     int updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData,
                          types::DbusVariantType& o_updatedValue);
 
+    /**
+     * @brief Update list of keywords' value.
+     *
+     * This API is used to update a list of keywords of a single FRU on its
+     * EEPROM path and redundant path(s) if any taken from system config JSON.
+     * The EEPROM is read once, ECC of each touched record is recomputed once,
+     * reboot guard is held once for the whole update and all the keywords are
+     * published on DBus with a single PIM notify call. The redundant path is
+     * updated in parallel to the EEPROM path. Keywords are published only
+     * once both the paths are updated, and the update is reverted on both the
+     * paths if any step fails.
+     *
+     * Each entry of the list follows the same format as accepted by
+     * updateVpdKeyword API.
+     *
+     * @param[in] i_paramsToWriteData - List of input details.
+     * @param[out] o_updatedData - List of keywords' value after the update, as
+     * verified on hardware by read back of the write, in the same order as
+     * input.
+     *
+     * @return On success returns total number of bytes written, on failure
+     * returns -1.
+     */
+    int updateVpdKeywords(const types::ListOfWriteVpdParams& i_paramsToWriteData,
+                          types::ListOfWriteVpdParams& o_updatedData);
+
     /**
      * @brief Update keyword value on hardware.
      *
@@ -113,34 +180,121 @@ class Parser
 
   private:
     /**
-     * @brief Update keyword value on redundant path.
+     * @brief Update list of keywords' value on redundant path.
      *
-     * This API is used to update keyword value on the given redundant path(s).
+     * This API is used to update keywords' value on the given redundant path.
+     * Value of the keywords before the update are returned, so that the
+     * update can be reverted.
      *
-     * To update IPZ type VPD, input parameter for writing should be in the form
-     * of (Record, Keyword, Value). Eg: ("VINI", "SN", {0x01, 0x02, 0x03}).
-     *
-     * To update Keyword type VPD, input parameter for writing should be in the
-     * form of (Keyword, Value). Eg: ("PE", {0x01, 0x02, 0x03}).
+     * Each entry of the list follows the same format as accepted by
+     * updateVpdKeyword API.
      *
      * @param[in] i_fruPath - Redundant EEPROM path.
-     * @param[in] i_paramsToWriteData - Input details.
+     * @param[in] i_paramsToWriteData - List of input details.
+     * @param[out] o_previousData - List of keywords' value before the update,
+     * empty if it couldn't be read for all the keywords.
      *
      * @return On success returns number of bytes written, on failure returns
      * -1.
      */
-    int updateVpdKeywordOnRedundantPath(
+    int updateVpdKeywordsOnRedundantPath(
         const std::string& i_fruPath,
-        const types::WriteVpdParams& i_paramsToWriteData);
+        const types::ListOfWriteVpdParams& i_paramsToWriteData,
+        types::ListOfWriteVpdParams& o_previousData);
+
+    /**
+     * @brief Wait for update on redundant path and keep it consistent with
+     * update on primary path.
+     *
+     * If update failed on primary path but succeeded on redundant path, the
+     * update on redundant path is reverted. If the paths still end up with
+     * different values, a PEL is logged.
+     *
+     * @param[in] i_redundantFruPath - Redundant EEPROM path.
+     * @param[in,out] io_redundantPathUpdate - Update in progress on redundant
+     * path, invalid if there is no redundant path.
+     * @param[in] i_previousData - List of keywords' value on redundant path
+     * before the update.
+     * @param[in] i_isPrimaryPathUpdated - Whether update on primary path
+     * succeeded.
+     *
+     * @return true if update on redundant path succeeded or there is no
+     * redundant path, false otherwise.
+     */
+    bool syncRedundantPathUpdate(
+        const std::string& i_redundantFruPath,
+        std::future<int>& io_redundantPathUpdate,
+        const types::ListOfWriteVpdParams& i_previousData,
+        bool i_isPrimaryPathUpdated);
+
+    /**
+     * @brief Publish list of keywords' value on DBus.
+     *
+     * Value of the keywords is read from the cached VPD and published with a
+     * single PIM notify call. Cached VPD holds the bytes verified on hardware
+     * by read back of the write, so no further EEPROM read is done.
+     *
+     * @param[in] i_inventoryObjPath - Inventory object path of the FRU.
+     * @param[in,out] io_updatedData - List of keywords, updated with the
+     * value read from the cached VPD.
+     *
+     * @throw std::runtime_error
+     */
+    void publishVpdKeywords(const std::string& i_inventoryObjPath,
+                            types::ListOfWriteVpdParams& io_updatedData);
+
+    /**
+     * @brief Revert update of list of keywords' value.
+     *
+     * Keywords are reverted on the EEPROM path and on redundant path, if
+     * given. A PEL is logged if any of them could not be reverted.
+     *
+     * @param[in] i_previousData - List of keywords' value on EEPROM path
+     * before the update.
+     * @param[in] i_redundantFruPath - Redundant EEPROM path, empty if not to
+     * be reverted.
+     * @param[in] i_previousDataOnRedundantPath - List of keywords' value on
+     * redundant path before the update.
+     */
+    void revertVpdKeywords(
+        const types::ListOfWriteVpdParams& i_previousData,
+        const std::string& i_redundantFruPath,
+        const types::ListOfWriteVpdParams& i_previousDataOnRedundantPath)
+        noexcept;
+
+    /**
+     * @brief Update list of keywords' value on hardware, keeping their value
+     * before the update.
+     *
+     * @param[in] i_fruPath - EEPROM path.
+     * @param[in] i_vpdParser - Parser of VPD on the EEPROM.
+     * @param[in] i_paramsToWriteData - List of input details.
+     * @param[out] o_previousData - List of keywords' value before the update,
+     * empty if it couldn't be read for all the keywords.
+     *
+     * @return On success returns number of bytes written, on failure returns
+     * -1.
+     */
+    static int writeVpdKeywordsKeepingPreviousData(
+        const std::string& i_fruPath, ParserInterface& i_vpdParser,
+        const types::ListOfWriteVpdParams& i_paramsToWriteData,
+        types::ListOfWriteVpdParams& o_previousData);
 
     // holds offfset to VPD if applicable.
     size_t m_vpdStartOffset = 0;
 
+    // Write page size of the EEPROM.
+    size_t m_writePageSize = constants::EEPROM_WRITE_PAGE_SIZE;
+
     // Path to the VPD file
-    const std::string& m_vpdFilePath;
+    const std::string m_vpdFilePath;
+
+    // Parsed system config JSON, held till the object is destroyed.
+    const std::shared_ptr<const nlohmann::json> m_sysCfgJsonObj;
 
-    // Path to configuration file, can be empty.
-    nlohmann::json m_parsedJson;
+    // Parsed system config JSON, refers to the JSON held by m_sysCfgJsonObj.
+    // Can be empty.
+    const nlohmann::json& m_parsedJson;
 
     // Vector to hold VPD.
     types::BinaryVector m_vpdVector;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "constants.hpp"
 #include "logger.hpp"
 #include "parser_interface.hpp"
 #include "types.hpp"
@@ -36,15 +37,20 @@ class ParserFactory
      * Note: API throws DataException in case vpd type check fails for any
      * unknown type. Caller responsibility to handle the exception.
      *
-     * @param[in] i_vpdVector - vpd file content to check for the type.
+     * @param[in,out] i_vpdVector - vpd file content to check for the type.
+     * Parser refers to it and updates it on keyword write, so it must outlive
+     * the parser.
      * @param[in] i_vpdFilePath - FRU EEPROM path.
      * @param[in] i_vpdStartOffset - Offset from where VPD starts in the VPD
      * file.
+     * @param[in] i_writePageSize - Write page size of the EEPROM, used by
+     * parsers which write on hardware.
      *
      * @return - Pointer to concrete parser class object.
      */
     static std::shared_ptr<ParserInterface> getParser(
-        const types::BinaryVector& i_vpdVector,
-        const std::string& i_vpdFilePath, size_t i_vpdStartOffset);
+        types::BinaryVector& i_vpdVector, const std::string& i_vpdFilePath,
+        size_t i_vpdStartOffset,
+        size_t i_writePageSize = constants::EEPROM_WRITE_PAGE_SIZE);
 };
 } // namespace vpd
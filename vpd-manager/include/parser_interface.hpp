@@ -61,6 +61,27 @@ class ParserInterface
         return -1;
     }
 
+    /**
+     * @brief API to write a list of keywords' value on hardware.
+     *
+     * This virtual method is created to allow derived classes to write
+     * multiple keywords of a FRU in a single pass over the VPD, so that any
+     * integrity data (like ECC) is recomputed only once per affected section.
+     *
+     * @param[in] i_paramsToWriteData - List of data required to perform write.
+     *
+     * @throw May throw exception depending on the implementation of derived
+     * methods.
+     * @return On success returns total number of bytes written on hardware, On
+     * failure returns -1.
+     */
+    virtual int writeKeywordsOnHardware(
+        const types::ListOfWriteVpdParams& i_paramsToWriteData)
+    {
+        (void)i_paramsToWriteData;
+        return -1;
+    }
+
     /**
      * @brief Virtual destructor.
      */
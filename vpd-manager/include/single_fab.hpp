@@ -1,6 +1,7 @@
 #pragma once
 
 #include "constants.hpp"
+#include "types.hpp"
 #include "utility/event_logger_utility.hpp"
 
 #include <string>
@@ -26,9 +27,16 @@ class SingleFab
      * System mode can be of field mode or lab mode and system image can be
      * special or normal image.
      *
+     * Planar IM is taken from the given parsed planar VPD, planar EEPROM is
+     * read only if the parsed VPD is not available.
+     *
+     * @param[in,out] io_parsedPlanarVpd - Parsed planar VPD, if available.
+     * Updated if IM value is changed on planar.
+     *
      * @return 0 on success, -1 in case of failure.
      */
-    int singleFabImOverride() const noexcept;
+    int singleFabImOverride(
+        types::VPDMapVariant& io_parsedPlanarVpd) const noexcept;
 
   private:
     /**
@@ -41,26 +49,34 @@ class SingleFab
     /**
      * @brief API to get IM value from system planar EEPROM path.
      *
+     * @param[in] i_parsedPlanarVpd - Parsed planar VPD, if available.
+     *
      * @return IM value on success, empty string otherwise.
      */
-    std::string getImFromPlanar() const noexcept;
+    std::string getImFromPlanar(
+        const types::VPDMapVariant& i_parsedPlanarVpd) const noexcept;
 
     /**
      * @brief API to update IM value on system planar EEPROM path.
      *
      * @param[in] i_imValue - IM value to be updated.
+     * @param[in,out] io_parsedPlanarVpd - Parsed planar VPD, if available.
+     * IM value in it is updated on success.
      *
      * @return true if value updated successfully, otherwise false.
      */
-    bool setImOnPlanar(const std::string& i_imValue) const noexcept;
+    bool setImOnPlanar(const std::string& i_imValue,
+                       types::VPDMapVariant& io_parsedPlanarVpd) const noexcept;
 
     /**
      * @brief API to update IM value on system planar EEPROM path to P11 series.
      *
      * @param[in] i_currentImValuePlanar - current IM value in planar EEPROM.
+     * @param[in,out] io_parsedPlanarVpd - Parsed planar VPD, if available.
      */
     void updateSystemImValueInVpdToP11Series(
-        std::string i_currentImValuePlanar) const noexcept;
+        std::string i_currentImValuePlanar,
+        types::VPDMapVariant& io_parsedPlanarVpd) const noexcept;
 
     /**
      * @brief API to check if it is a P10 system.
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace vpd
+{
+/**
+ * @brief Class to record time spans of VPD collection steps.
+ *
+ * Tracing is off till a trace is started, a span costs a single atomic load
+ * then. Once started, spans are recorded to a circular buffer of fixed
+ * capacity, the oldest span being overwritten when the buffer is full. The
+ * recorded spans can be dumped as Chrome trace event JSON, to be viewed in
+ * chrome://tracing or Perfetto UI.
+ *
+ * Recording a span takes no lock and does no allocation. A slot is claimed
+ * with an atomic increment and name and context are copied, truncated if
+ * required, to fixed size storage of the slot. Each slot carries a sequence
+ * number, so that a dump skips slots being written or overwritten meanwhile.
+ */
+class Tracer
+{
+  public:
+    /**
+     * List of deleted methods.
+     */
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+    Tracer(Tracer&&) = delete;
+    Tracer& operator=(Tracer&&) = delete;
+
+    /**
+     * @brief Method to get instance of Tracer class.
+     */
+    static Tracer& getTracerInstance()
+    {
+        static Tracer l_tracer;
+        return l_tracer;
+    }
+
+    /**
+     * @brief API to start a trace.
+     *
+     * Spans recorded by any earlier trace are discarded.
+     */
+    void startTrace() noexcept;
+
+    /**
+     * @brief API to stop the trace in progress.
+     *
+     * Recorded spans are kept till the next trace is started.
+     */
+    void stopTrace() noexcept
+    {
+        m_isEnabled.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to check if a trace is in progress.
+     *
+     * @return true if spans are being recorded, false otherwise.
+     */
+    bool isEnabled() const noexcept
+    {
+        return m_isEnabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief API to record a span.
+     *
+     * Span is dropped if no trace is in progress.
+     *
+     * @param[in] i_name - Name of the span.
+     * @param[in] i_context - Context of the span, e.g. EEPROM path.
+     * @param[in] i_startTime - Start time of the span.
+     * @param[in] i_endTime - End time of the span.
+     */
+    void recordSpan(std::string_view i_name, std::string_view i_context,
+                    std::chrono::steady_clock::time_point i_startTime,
+                    std::chrono::steady_clock::time_point i_endTime) noexcept;
+
+    /**
+     * @brief API to dump recorded spans as Chrome trace event JSON.
+     *
+     * @param[in] i_filePath - File to dump the spans to.
+     *
+     * @return true on success, false otherwise.
+     */
+    bool dumpChromeTrace(const std::string& i_filePath) const noexcept;
+
+  private:
+    /**
+     * @brief Constructor
+     */
+    Tracer() = default;
+
+    // Maximum length of span name, including null terminator.
+    static constexpr size_t MAX_NAME_LENGTH = 32;
+
+    // Maximum length of span context, including null terminator.
+    static constexpr size_t MAX_CONTEXT_LENGTH = 96;
+
+    /**
+     * @brief Structure of a recorded span.
+     */
+    struct Span
+    {
+        // Index of the span plus one once it is recorded, 0 while it is being
+        // written.
+        std::atomic<size_t> m_sequence{0};
+
+        // Name of the span, null terminated.
+        std::array<char, MAX_NAME_LENGTH> m_name{};
+
+        // Context of the span, null terminated.
+        std::array<char, MAX_CONTEXT_LENGTH> m_context{};
+
+        // Start time of the span.
+        std::chrono::steady_clock::time_point m_startTime;
+
+        // End time of the span.
+        std::chrono::steady_clock::time_point m_endTime;
+
+        // Thread which recorded the span.
+        int m_threadId = 0;
+    };
+
+    // Maximum spans that can be held.
+    static constexpr size_t MAX_SPANS = 2048;
+
+    // Holds if a trace is in progress.
+    std::atomic<bool> m_isEnabled{false};
+
+    // Reference time of the spans, start time of the trace. Guarded by
+    // m_mutex.
+    std::chrono::steady_clock::time_point m_startTime;
+
+    // Index of the first span of the trace. Guarded by m_mutex.
+    size_t m_firstSpanIndex = 0;
+
+    // Number of spans recorded ever, index of the next span. Never reset, so
+    // that a slot's sequence number is unique across traces.
+    std::atomic<size_t> m_spanCount{0};
+
+    // Recorded spans, span of index N is held at N % MAX_SPANS.
+    std::array<Span, MAX_SPANS> m_spans;
+
+    // Mutex to serialize start of trace and dump of spans.
+    mutable std::mutex m_mutex;
+};
+
+/**
+ * @brief RAII object recording a span from its construction till destruction.
+ *
+ * Name and context are referred to, not copied, so they must outlive the
+ * object.
+ */
+class TraceSpan
+{
+  public:
+    /**
+     * List of deleted methods.
+     */
+    TraceSpan() = delete;
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+    TraceSpan(TraceSpan&&) = delete;
+    TraceSpan& operator=(TraceSpan&&) = delete;
+
+    /**
+     * @brief Constructor
+     *
+     * @param[in] i_name - Name of the span.
+     * @param[in] i_context - Context of the span, e.g. EEPROM path.
+     */
+    explicit TraceSpan(std::string_view i_name,
+                       std::string_view i_context = {}) noexcept :
+        m_name(i_name), m_context(i_context),
+        m_isEnabled(Tracer::getTracerInstance().isEnabled())
+    {
+        if (m_isEnabled)
+        {
+            m_startTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    /**
+     * @brief Destructor, records the span.
+     */
+    ~TraceSpan()
+    {
+        if (m_isEnabled)
+        {
+            Tracer::getTracerInstance().recordSpan(
+                m_name, m_context, m_startTime,
+                std::chrono::steady_clock::now());
+        }
+    }
+
+  private:
+    // Name of the span.
+    const std::string_view m_name;
+
+    // Context of the span.
+    const std::string_view m_context;
+
+    // Holds if a trace was in progress when the span started.
+    const bool m_isEnabled;
+
+    // Start time of the span.
+    std::chrono::steady_clock::time_point m_startTime;
+};
+} // namespace vpd
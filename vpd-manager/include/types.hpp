@@ -21,8 +21,8 @@ using BiosProperty = std::tuple<
     std::variant<int64_t, std::string>, std::variant<int64_t, std::string>,
     std::vector<std::tuple<std::string, std::variant<int64_t, std::string>,
                            std::string>>>;
-using BiosBaseTable =
-    std::variant<std::monostate, std::map<std::string, BiosProperty>>;
+using BiosAttributeTable = std::map<std::string, BiosProperty>;
+using BiosBaseTable = std::variant<std::monostate, BiosAttributeTable>;
 using BiosBaseTableType = std::map<std::string, BiosBaseTable>;
 using BiosAttributeCurrentValue =
     std::variant<std::monostate, int64_t, std::string>;
@@ -135,9 +135,14 @@ using VpdData = std::variant<IpzData, KwData>;
 using IpzType = std::tuple<Record, Keyword>;
 using ReadVpdParams = std::variant<IpzType, Keyword>;
 using WriteVpdParams = std::variant<IpzData, KwData>;
+using ListOfWriteVpdParams = std::vector<WriteVpdParams>;
 
 using ListOfPaths = std::vector<sdbusplus::message::object_path>;
 using RecordData = std::tuple<RecordOffset, RecordLength, ECCOffset, ECCLength>;
+/* Map<Record, Record details from VTOC> */
+using RecordIndex = std::unordered_map<Record, RecordData>;
+/* Map<Keyword, Pair<Keyword's data offset, Keyword's data length>> */
+using KeywordIndex = std::unordered_map<Keyword, std::pair<size_t, size_t>>;
 
 using DbusInvalidArgument =
     sdbusplus::xyz::openbmc_project::Common::Error::InvalidArgument;
@@ -216,8 +221,6 @@ using ExceptionDataMap = std::map<std::string, ExceptionInfoVariant>;
 using InvalidRecordEntry = std::pair<Record,ErrorType>;
 /* List of invalid record entries*/
 using InvalidRecordList = std::vector<InvalidRecordEntry>;
-/* Map of inventory path -> Present property match object */
-using FruPresenceMatchObjectMap = std::map<Path, std::shared_ptr<sdbusplus::bus::match_t>>;
 /* A map of interface to match object*/
 using MatchObjectInterfaceMap = std::map<std::string,std::shared_ptr<sdbusplus::bus::match_t>>;
 /* A map of service name to match object interface map*/
@@ -234,6 +237,8 @@ using PelInfoTuple =
 using DbusPropertyEntry = std::tuple<std::string, std::string, std::string>;
 /* A list of Dbus property entries */
 using DbusPropertyList = std::vector<DbusPropertyEntry>;
+/* Map of {service, interface, property, object path} key -> correlated properties */
+using CorrelatedPropsMap = std::unordered_map<std::string, DbusPropertyList>;
 
 using CommonProgress = sdbusplus::common::xyz::openbmc_project::common::Progress;
 using VpdCollectionStatus = CommonProgress::OperationStatus;
@@ -242,6 +247,11 @@ using VpdCollectionStatus = CommonProgress::OperationStatus;
 using EepromInventoryPaths = std::tuple<std::string, std::string>;
 using BinaryStringKwValuePair = std::tuple<types::BinaryVector, std::string>;
 
+/* Tuple of <EEPROM path, VPD read from the EEPROM, VPD start offset> */
+using EepromVpdData = std::tuple<std::string, BinaryVector, size_t>;
+/* Pair of EEPROM path and D-Bus data populated from its VPD */
+using EepromObjectMap = std::pair<std::string, ObjectMap>;
+
 /* Tuple of<source record name, source keyword name, destination record name, destination keyword
      * name, default value> */
 using SrcDstRecordDetails = std::tuple<std::string&, std::string&, std::string&, std::string&,
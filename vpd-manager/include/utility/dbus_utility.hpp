@@ -1,11 +1,19 @@
 #pragma once
 
 #include "constants.hpp"
+#include "error_codes.hpp"
 #include "exceptions.hpp"
 #include "logger.hpp"
+#include "metrics.hpp"
 #include "types.hpp"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace vpd
 {
@@ -15,6 +23,25 @@ namespace vpd
 namespace dbusUtility
 {
 
+/**
+ * @brief API to get D-Bus connection of the calling thread.
+ *
+ * A connection is opened on first call from a thread and is reused by the
+ * later calls from the same thread. A connection is used only by the thread
+ * which opened it, as sd-bus connections are not thread safe.
+ *
+ * Connection is closed when its thread exits. Threads created per operation,
+ * e.g. FRU collection pipeline threads or redundant EEPROM writers, open a
+ * connection each, which is reused only for the calls made by that thread.
+ *
+ * @return Connection of the calling thread.
+ */
+inline sdbusplus::bus_t& getBus()
+{
+    thread_local sdbusplus::bus_t l_bus = sdbusplus::bus::new_default();
+    return l_bus;
+}
+
 /**
  * @brief An API to get Map of service and interfaces for an object path.
  *
@@ -44,7 +71,7 @@ inline types::MapperGetObject getObjectMap(
 
     try
     {
-        auto bus = sdbusplus::bus::new_default();
+        auto& bus = getBus();
         auto method = bus.new_method_call(
             "xyz.openbmc_project.ObjectMapper",
             "/xyz/openbmc_project/object_mapper",
@@ -92,7 +119,7 @@ inline types::PropertyMap getPropertyMap(const std::string& i_service,
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method =
             l_bus.new_method_call(i_service.c_str(), i_objectPath.c_str(),
                                   "org.freedesktop.DBus.Properties", "GetAll");
@@ -117,12 +144,13 @@ inline types::PropertyMap getPropertyMap(const std::string& i_service,
  * be returned.
  *
  * Note: Depth can be 0 and interfaces can be null.
- * It will be caller's responsibility to check for empty vector returned
- * and generate appropriate error.
+ * An empty map is also returned when no object matches, so caller has to
+ * check the error code to know if the call failed.
  *
  * @param[in] i_objectPath - Path to search for an interface.
  * @param[in] i_depth - Maximum depth of the tree to search.
  * @param[in] i_interfaces - List of interfaces to search.
+ * @param[out] o_errCode - To set error code in case of error.
  *
  * @return - A map of object and its related services and interfaces, if
  *           success. If failed, empty map.
@@ -130,19 +158,20 @@ inline types::PropertyMap getPropertyMap(const std::string& i_service,
 
 inline types::MapperGetSubTree getObjectSubTree(
     const std::string& i_objectPath, const int& i_depth,
-    const std::vector<std::string>& i_interfaces)
+    const std::vector<std::string>& i_interfaces, uint16_t& o_errCode)
 {
     types::MapperGetSubTree l_subTreeMap;
+    o_errCode = 0;
 
     if (i_objectPath.empty())
     {
-        logging::logMessage("Object path is empty.");
+        o_errCode = error_code::INVALID_INPUT_PARAMETER;
         return l_subTreeMap;
     }
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::objectMapperService, constants::objectMapperPath,
             constants::objectMapperInf, "GetSubTree");
@@ -153,11 +182,226 @@ inline types::MapperGetSubTree getObjectSubTree(
     catch (const sdbusplus::exception::SdBusError& l_ex)
     {
         logging::logMessage(l_ex.what());
+        l_subTreeMap.clear();
+        o_errCode = error_code::DBUS_FAILURE;
     }
 
     return l_subTreeMap;
 }
 
+/**
+ * @brief API to get all the objects managed by a service's object manager.
+ *
+ * Objects, their interfaces and properties are fetched with a single
+ * GetManagedObjects call.
+ *
+ * Note: An empty map is also returned when the service manages no object, so
+ * caller has to check the error code to know if the call failed.
+ *
+ * @param[in] i_service - Service name.
+ * @param[in] i_objectManagerPath - Path of the service's object manager.
+ * @param[out] o_errCode - To set error code in case of error.
+ *
+ * @return - A map of object to its interfaces and properties, if success.
+ *           If failed, empty map.
+ */
+inline types::ObjectMap getManagedObjects(
+    const std::string& i_service, const std::string& i_objectManagerPath,
+    uint16_t& o_errCode)
+{
+    types::ObjectMap l_managedObjects;
+    o_errCode = 0;
+
+    if (i_service.empty() || i_objectManagerPath.empty())
+    {
+        o_errCode = error_code::INVALID_INPUT_PARAMETER;
+        return l_managedObjects;
+    }
+
+    try
+    {
+        auto& l_bus = getBus();
+        auto l_method = l_bus.new_method_call(
+            i_service.c_str(), i_objectManagerPath.c_str(),
+            "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
+        auto l_result = l_bus.call(l_method);
+        l_result.read(l_managedObjects);
+    }
+    catch (const sdbusplus::exception::SdBusError& l_ex)
+    {
+        logging::logMessage(l_ex.what());
+        l_managedObjects.clear();
+        o_errCode = error_code::DBUS_FAILURE;
+    }
+
+    return l_managedObjects;
+}
+
+/**
+ * @brief Cache of inventory objects hosted by PIM.
+ */
+struct PimObjectCache
+{
+    // Map of object path to its interfaces hosted by PIM.
+    std::unordered_map<std::string, std::vector<std::string>> m_objects;
+
+    // Holds if cache is loaded from mapper.
+    bool m_isLoaded = false;
+
+    // Mutex to guard the cache.
+    std::shared_mutex m_mutex;
+
+    // Mutex to serialize loading of the cache.
+    std::mutex m_loadMutex;
+};
+
+/**
+ * @brief API to get cache of inventory objects hosted by PIM.
+ *
+ * @return Cache of objects hosted by PIM.
+ */
+inline PimObjectCache& getPimObjectCache() noexcept
+{
+    static PimObjectCache l_pimObjectCache;
+    return l_pimObjectCache;
+}
+
+/**
+ * @brief API to refresh cache of inventory objects hosted by PIM.
+ *
+ * The whole inventory subtree is fetched from mapper with a single GetSubTree
+ * call, in place of a GetObject call per object. If the subtree can't be
+ * fetched, the cache is left not loaded, so that it is loaded on next use.
+ *
+ * @param[out] o_errCode - To set error code in case of error.
+ */
+inline void refreshPimObjectCache(uint16_t& o_errCode)
+{
+    auto& l_cache = getPimObjectCache();
+    std::scoped_lock l_loadLock(l_cache.m_loadMutex);
+
+    // All the interfaces are required, to know the VPD interfaces of objects.
+    const types::MapperGetSubTree l_subTree = getObjectSubTree(
+        constants::pimPath, 0, std::vector<std::string>{}, o_errCode);
+
+    if (o_errCode)
+    {
+        std::unique_lock l_lock(l_cache.m_mutex);
+        l_cache.m_objects.clear();
+        l_cache.m_isLoaded = false;
+        return;
+    }
+
+    std::unordered_map<std::string, std::vector<std::string>> l_objects;
+    for (const auto& [l_objectPath, l_serviceInterfaceMap] : l_subTree)
+    {
+        const auto l_itr =
+            l_serviceInterfaceMap.find(constants::pimServiceName);
+        if (l_itr != l_serviceInterfaceMap.end())
+        {
+            l_objects.emplace(l_objectPath, l_itr->second);
+        }
+    }
+
+    std::unique_lock l_lock(l_cache.m_mutex);
+    l_cache.m_objects = std::move(l_objects);
+    l_cache.m_isLoaded = true;
+}
+
+/**
+ * @brief API to add objects published on PIM to the cache.
+ *
+ * Nothing is added if the cache is not loaded yet, as loading fetches them
+ * anyway.
+ *
+ * @param[in] i_objects - Map of object path to its interfaces published on
+ * PIM.
+ */
+inline void addToPimObjectCache(
+    const std::unordered_map<std::string, std::vector<std::string>>& i_objects)
+{
+    auto& l_cache = getPimObjectCache();
+    std::unique_lock l_lock(l_cache.m_mutex);
+    if (!l_cache.m_isLoaded)
+    {
+        return;
+    }
+
+    for (const auto& [l_objectPath, l_publishedInterfaces] : i_objects)
+    {
+        auto& l_interfaces = l_cache.m_objects[l_objectPath];
+        for (const auto& l_interface : l_publishedInterfaces)
+        {
+            if (std::find(l_interfaces.begin(), l_interfaces.end(),
+                          l_interface) == l_interfaces.end())
+            {
+                l_interfaces.push_back(l_interface);
+            }
+        }
+    }
+}
+
+/**
+ * @brief API to get interfaces of an object hosted by PIM.
+ *
+ * The interfaces are read from cache, which is loaded on first call. If the
+ * cache can't be loaded, mapper is asked for the object alone.
+ *
+ * @param[in] i_objectPath - Inventory object path.
+ *
+ * @return Interfaces hosted by PIM, empty if object is not hosted by PIM.
+ */
+inline std::vector<std::string> getPimHostedInterfaces(
+    const std::string& i_objectPath)
+{
+    auto& l_cache = getPimObjectCache();
+    {
+        std::shared_lock l_lock(l_cache.m_mutex);
+        if (l_cache.m_isLoaded)
+        {
+            const auto l_itr = l_cache.m_objects.find(i_objectPath);
+            return (l_itr != l_cache.m_objects.end())
+                       ? l_itr->second
+                       : std::vector<std::string>{};
+        }
+    }
+
+    uint16_t l_errCode = 0;
+    refreshPimObjectCache(l_errCode);
+
+    if (l_errCode)
+    {
+        const types::MapperGetObject l_objectMap =
+            getObjectMap(i_objectPath, std::vector<std::string>{});
+
+        const auto l_itr = std::find_if(
+            l_objectMap.begin(), l_objectMap.end(), [](const auto& l_service) {
+                return l_service.first == constants::pimServiceName;
+            });
+
+        return (l_itr != l_objectMap.end()) ? l_itr->second
+                                            : std::vector<std::string>{};
+    }
+
+    return getPimHostedInterfaces(i_objectPath);
+}
+
+/**
+ * @brief API to check if an interface of an object is hosted by PIM.
+ *
+ * @param[in] i_objectPath - Inventory object path.
+ * @param[in] i_interface - Interface.
+ *
+ * @return true if hosted by PIM, false otherwise.
+ */
+inline bool isHostedByPim(const std::string& i_objectPath,
+                          const std::string& i_interface)
+{
+    const auto l_interfaces = getPimHostedInterfaces(i_objectPath);
+    return std::find(l_interfaces.begin(), l_interfaces.end(), i_interface) !=
+           l_interfaces.end();
+}
+
 /**
  * @brief An API to read property from Dbus.
  *
@@ -192,7 +436,7 @@ inline types::DbusVariantType readDbusProperty(
 
     try
     {
-        auto bus = sdbusplus::bus::new_default();
+        auto& bus = getBus();
         auto method =
             bus.new_method_call(serviceName.c_str(), objectPath.c_str(),
                                 "org.freedesktop.DBus.Properties", "Get");
@@ -236,7 +480,7 @@ inline bool writeDbusProperty(
             throw std::runtime_error("Dbus write failed, Parameter empty");
         }
 
-        auto bus = sdbusplus::bus::new_default();
+        auto& bus = getBus();
         auto method =
             bus.new_method_call(serviceName.c_str(), objectPath.c_str(),
                                 "org.freedesktop.DBus.Properties", "Set");
@@ -263,6 +507,21 @@ inline bool writeDbusProperty(
  */
 inline bool callPIM(types::ObjectMap&& objectMap)
 {
+    Metrics::getMetricsInstance().increment(Counter::PimNotifyCalls);
+    const ScopedLatency l_latency(Histogram::PimNotifyLatency);
+
+    // Objects are added to the cache with their full path, as published.
+    std::unordered_map<std::string, std::vector<std::string>>
+        l_publishedObjects;
+    for (const auto& [l_objectPath, l_interfaceMap] : objectMap)
+    {
+        auto& l_interfaces = l_publishedObjects[l_objectPath.str];
+        for (const auto& l_interface : l_interfaceMap)
+        {
+            l_interfaces.push_back(l_interface.first);
+        }
+    }
+
     try
     {
         for (const auto& l_objectKeyValue : objectMap)
@@ -277,7 +536,7 @@ inline bool callPIM(types::ObjectMap&& objectMap)
             }
         }
 
-        auto bus = sdbusplus::bus::new_default();
+        auto& bus = getBus();
         auto pimMsg =
             bus.new_method_call(constants::pimServiceName, constants::pimPath,
                                 constants::pimIntf, "Notify");
@@ -286,8 +545,11 @@ inline bool callPIM(types::ObjectMap&& objectMap)
     }
     catch (const sdbusplus::exception::SdBusError& e)
     {
+        Metrics::getMetricsInstance().increment(Counter::PimNotifyFailures);
         return false;
     }
+
+    addToPimObjectCache(l_publishedObjects);
     return true;
 }
 
@@ -335,7 +597,7 @@ inline bool isServiceRunning(const std::string& i_serviceName)
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             "org.freedesktop.DBus", "/org/freedesktop/DBus",
             "org.freedesktop.DBus", "NameHasOwner");
@@ -372,7 +634,7 @@ inline types::BiosAttributeCurrentValue biosGetAttributeMethodCall(
     types::BiosGetAttrRetType l_attributeVal;
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
             constants::biosConfigMgrInterface, "GetAttribute");
@@ -395,87 +657,221 @@ inline types::BiosAttributeCurrentValue biosGetAttributeMethodCall(
 }
 
 /**
- * @brief API to check if Chassis is powered on.
+ * @brief API to read BIOS attribute table from BIOS manager.
  *
- * This API queries Phosphor Chassis State Manager to know whether
- * Chassis is powered on.
+ * The API reads "BaseBIOSTable" property in one call, which carries current
+ * value of all the BIOS attributes.
  *
- * @return true if chassis is powered on, false otherwise
+ * @return BIOS attribute table, empty map in case of any error.
  */
-inline bool isChassisPowerOn()
+inline types::BiosAttributeTable getBiosAttributeTable() noexcept
 {
-    auto powerState = dbusUtility::readDbusProperty(
-        "xyz.openbmc_project.State.Chassis",
-        "/xyz/openbmc_project/state/chassis0",
-        "xyz.openbmc_project.State.Chassis", "CurrentPowerState");
+    std::variant<types::BiosAttributeTable> l_biosBaseTable;
+    try
+    {
+        auto& l_bus = getBus();
+        auto l_method = l_bus.new_method_call(
+            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
+            "org.freedesktop.DBus.Properties", "Get");
+        l_method.append(constants::biosConfigMgrInterface, "BaseBIOSTable");
 
-    if (auto curPowerState = std::get_if<std::string>(&powerState))
+        auto l_result = l_bus.call(l_method);
+        l_result.read(l_biosBaseTable);
+    }
+    catch (const sdbusplus::exception::SdBusError& l_ex)
     {
-        if ("xyz.openbmc_project.State.Chassis.PowerState.On" == *curPowerState)
-        {
-            return true;
-        }
-        return false;
+        logging::logMessage(
+            "Failed to read BIOS attribute table due to error " +
+            std::string(l_ex.what()));
+    }
+
+    return std::get<types::BiosAttributeTable>(l_biosBaseTable);
+}
+
+/**
+ * @brief Enum of system states cached by vpd-manager.
+ */
+enum class SystemState : size_t
+{
+    ChassisPowerOn,
+    HostRunning,
+    BmcReady,
+    Count
+};
+
+/**
+ * @brief D-Bus property backing a system state.
+ *
+ * A state is true when the property holds the given value.
+ */
+struct SystemStateProperty
+{
+    const char* m_service;
+    const char* m_objectPath;
+    const char* m_interface;
+    const char* m_property;
+    const char* m_value;
+};
+
+/**
+ * @brief API to get D-Bus property backing a system state.
+ *
+ * @param[in] i_state - System state.
+ *
+ * @return D-Bus property of the state.
+ */
+inline const SystemStateProperty& getSystemStateProperty(
+    SystemState i_state) noexcept
+{
+    static constexpr std::array<SystemStateProperty,
+                                static_cast<size_t>(SystemState::Count)>
+        l_stateProperties{
+            {{constants::chassisStateService, constants::chassisZeroStateObject,
+              constants::chassisStateInterface,
+              constants::currentPowerStateProperty,
+              constants::chassisPowerOnState},
+             {constants::hostService, constants::hostObjectPath,
+              constants::hostInterface, constants::currentHostStateProperty,
+              constants::hostRunningState},
+             {constants::bmcStateService, constants::bmcZeroStateObject,
+              constants::bmcStateInterface,
+              constants::currentBMCStateProperty, constants::bmcReadyState}}};
+
+    return l_stateProperties[static_cast<size_t>(i_state)];
+}
+
+/**
+ * @brief API to get cache of system states.
+ *
+ * A state is cached only by a process which keeps it up to date by listening
+ * to PropertiesChanged signal of the state's property. A state not cached is
+ * -1, else 0 or 1.
+ *
+ * @return Cache of system states.
+ */
+inline std::array<std::atomic<int8_t>, static_cast<size_t>(SystemState::Count)>&
+    getSystemStateCache() noexcept
+{
+    static std::array<std::atomic<int8_t>,
+                      static_cast<size_t>(SystemState::Count)>
+        l_stateCache{-1, -1, -1};
+    return l_stateCache;
+}
+
+/**
+ * @brief API to set cached value of a system state.
+ *
+ * @param[in] i_state - System state.
+ * @param[in] i_value - Value of the state.
+ */
+inline void setCachedSystemState(SystemState i_state, bool i_value) noexcept
+{
+    getSystemStateCache()[static_cast<size_t>(i_state)].store(
+        i_value ? 1 : 0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief API to get cached value of a system state.
+ *
+ * @param[in] i_state - System state.
+ *
+ * @return Value of the state, std::nullopt if the state is not cached.
+ */
+inline std::optional<bool> getCachedSystemState(SystemState i_state) noexcept
+{
+    const auto l_value = getSystemStateCache()[static_cast<size_t>(i_state)]
+                             .load(std::memory_order_relaxed);
+    if (l_value < 0)
+    {
+        return std::nullopt;
+    }
+    return l_value == 1;
+}
+
+/**
+ * @brief API to read a system state from D-Bus.
+ *
+ * @param[in] i_state - System state.
+ *
+ * @return Value of the state, std::nullopt if the state can't be read.
+ */
+inline std::optional<bool> readSystemState(SystemState i_state)
+{
+    const auto& l_stateProperty = getSystemStateProperty(i_state);
+    const auto l_value = dbusUtility::readDbusProperty(
+        l_stateProperty.m_service, l_stateProperty.m_objectPath,
+        l_stateProperty.m_interface, l_stateProperty.m_property);
+
+    if (const auto l_strValue = std::get_if<std::string>(&l_value))
+    {
+        return *l_strValue == l_stateProperty.m_value;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief API to get a system state.
+ *
+ * Cached value is returned if the state is cached, else the state is read
+ * from D-Bus.
+ *
+ * @param[in] i_state - System state.
+ *
+ * @return Value of the state, false if the state can't be read.
+ */
+inline bool getSystemState(SystemState i_state)
+{
+    if (const auto l_cachedValue = getCachedSystemState(i_state))
+    {
+        return *l_cachedValue;
     }
+    return readSystemState(i_state).value_or(false);
+}
 
+/**
+ * @brief API to check if Chassis is powered on.
+ *
+ * This API queries Phosphor Chassis State Manager to know whether
+ * Chassis is powered on, unless chassis power state is cached.
+ *
+ * @return true if chassis is powered on, false otherwise
+ */
+inline bool isChassisPowerOn()
+{
     /*
-        TODO: Add PEL.
+        TODO: Add PEL if chassis state can't be read.
         Callout: Firmware callout
         Type: Informational
         Description: Chassis state can't be determined, defaulting to chassis
         off. : e.what()
     */
-    return false;
+    return getSystemState(SystemState::ChassisPowerOn);
 }
 
 /**
  * @brief API to check if host is in running state.
  *
- * This API reads the current host state from D-bus and returns true if the host
- * is running.
+ * This API reads the current host state from D-bus, unless host state is
+ * cached, and returns true if the host is running.
  *
  * @return true if host is in running state. false otherwise.
  */
 inline bool isHostRunning()
 {
-    const auto l_hostState = dbusUtility::readDbusProperty(
-        constants::hostService, constants::hostObjectPath,
-        constants::hostInterface, "CurrentHostState");
-
-    if (const auto l_currHostState = std::get_if<std::string>(&l_hostState))
-    {
-        if (*l_currHostState == constants::hostRunningState)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return getSystemState(SystemState::HostRunning);
 }
 
 /**
  * @brief API to check if BMC is in ready state.
  *
- * This API reads the current state of BMC from D-bus and returns true if BMC is
- * in ready state.
+ * This API reads the current state of BMC from D-bus, unless BMC state is
+ * cached, and returns true if BMC is in ready state.
  *
  * @return true if BMC is ready, false otherwise.
  */
 inline bool isBMCReady()
 {
-    const auto l_bmcState = dbusUtility::readDbusProperty(
-        constants::bmcStateService, constants::bmcZeroStateObject,
-        constants::bmcStateInterface, constants::currentBMCStateProperty);
-
-    if (const auto l_currBMCState = std::get_if<std::string>(&l_bmcState))
-    {
-        if (*l_currBMCState == constants::bmcReadyState)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return getSystemState(SystemState::BmcReady);
 }
 
 /**
@@ -490,7 +886,7 @@ inline int EnableRebootGuard() noexcept
     int l_rc{constants::FAILURE};
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::systemdService, constants::systemdObjectPath,
             constants::systemdManagerInterface, "StartUnit");
@@ -527,7 +923,7 @@ inline int DisableRebootGuard() noexcept
         int l_dBusCallRc{constants::FAILURE};
         try
         {
-            auto l_bus = sdbusplus::bus::new_default();
+            auto& l_bus = getBus();
             auto l_method = l_bus.new_method_call(
                 constants::systemdService, constants::systemdObjectPath,
                 constants::systemdManagerInterface, "StartUnit");
@@ -765,7 +1161,7 @@ inline std::vector<std::string> GetSubTreePaths(
     std::vector<std::string> l_objectPaths;
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::objectMapperService, constants::objectMapperPath,
             constants::objectMapperInf, "GetSubTreePaths");
@@ -784,6 +1180,35 @@ inline std::vector<std::string> GetSubTreePaths(
     return l_objectPaths;
 }
 
+/**
+ * @brief API to get unique connection name owning a well-known bus name.
+ *
+ * @param[in] i_busName - Well-known bus name.
+ *
+ * @return On success, returns unique connection name owning the bus name,
+ * empty string otherwise.
+ */
+inline std::string getNameOwner(const std::string& i_busName) noexcept
+{
+    std::string l_owner;
+    try
+    {
+        auto& l_bus = getBus();
+        auto l_method = l_bus.new_method_call(
+            "org.freedesktop.DBus", "/org/freedesktop/DBus",
+            "org.freedesktop.DBus", "GetNameOwner");
+        l_method.append(i_busName);
+        auto l_result = l_bus.call(l_method);
+        l_result.read(l_owner);
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Failed to get owner of bus name [" + i_busName +
+                            "], error: " + std::string(l_ex.what()));
+    }
+    return l_owner;
+}
+
 /**
  * @brief API to get Dbus service name for given connection identifier.
  *
@@ -802,7 +1227,7 @@ inline std::string getServiceNameFromConnectionId(
             throw std::runtime_error("Empty connection ID");
         }
 
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
 
         // get PID corresponding to the connection ID
         auto l_method = l_bus.new_method_call(
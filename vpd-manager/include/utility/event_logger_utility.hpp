@@ -4,6 +4,7 @@
 
 #include "common_utility.hpp"
 #include "constants.hpp"
+#include "dbus_utility.hpp"
 #include "exceptions.hpp"
 #include "json_utility.hpp"
 #include "logger.hpp"
@@ -528,7 +529,7 @@ inline void createSyncPel(
             {"UserData1", l_userData1.c_str()},
             {"UserData2", l_userData2.c_str()}};
 
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = dbusUtility::getBus();
         auto l_method =
             l_bus.new_method_call(constants::eventLoggingServiceName,
                                   constants::eventLoggingObjectPath,
@@ -667,7 +668,7 @@ inline void createSyncPelWithInvCallOut(
                  ? severityMap.at(i_severity)
                  : severityMap.at(types::SeverityType::Informational));
 
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = dbusUtility::getBus();
         auto l_method =
             l_bus.new_method_call(constants::eventLoggingServiceName,
                                   constants::eventLoggingObjectPath,
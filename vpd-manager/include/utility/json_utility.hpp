@@ -9,7 +9,9 @@
 #include <nlohmann/json.hpp>
 #include <utility/common_utility.hpp>
 
+#include <chrono>
 #include <fstream>
+#include <limits>
 #include <type_traits>
 #include <unordered_map>
 
@@ -1056,6 +1058,149 @@ inline bool isFruPowerOffOnly(const nlohmann::json& i_sysCfgJsonObj,
             (i_sysCfgJsonObj["frus"][i_vpdFruPath].at(0)["powerOffOnly"]));
 }
 
+/**
+ * @brief API to get priority of VPD collection of a FRU.
+ *
+ * Priority is taken from "collectionPriority" tag of the FRU, if present.
+ * Otherwise it is derived from the FRU's tags. Essential FRUs come first,
+ * followed by FRUs collected only at chassis power off, on which host power
+ * on waits, and then FRUs feeding other FRUs through an explicit
+ * "inherit": true or "copyRecords".
+ *
+ * @param[in] i_sysCfgJsonObj - System config JSON object.
+ * @param[in] i_vpdFruPath - EEPROM path.
+ * @param[out] o_errCode - To set error code for the error.
+ *
+ * @return Collection priority, higher is collected first.
+ * constants::COLLECTION_PRIORITY_DEFAULT in case of error, including a
+ * "collectionPriority" which is not an integer in range of uint8_t.
+ */
+inline uint8_t getFruCollectionPriority(const nlohmann::json& i_sysCfgJsonObj,
+                                        const std::string& i_vpdFruPath,
+                                        uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    if (i_vpdFruPath.empty())
+    {
+        o_errCode = error_code::INVALID_INPUT_PARAMETER;
+        return constants::COLLECTION_PRIORITY_DEFAULT;
+    }
+
+    if (!i_sysCfgJsonObj.contains("frus"))
+    {
+        o_errCode = error_code::INVALID_JSON;
+        return constants::COLLECTION_PRIORITY_DEFAULT;
+    }
+
+    if (!i_sysCfgJsonObj["frus"].contains(i_vpdFruPath))
+    {
+        o_errCode = error_code::FRU_PATH_NOT_FOUND;
+        return constants::COLLECTION_PRIORITY_DEFAULT;
+    }
+
+    try
+    {
+        const nlohmann::json& l_fruList = i_sysCfgJsonObj["frus"][i_vpdFruPath];
+        const nlohmann::json& l_baseFru = l_fruList.at(0);
+
+        if (l_baseFru.contains("collectionPriority"))
+        {
+            // get<uint8_t> wraps values out of range, check them upfront.
+            const nlohmann::json& l_priority = l_baseFru["collectionPriority"];
+            if (!l_priority.is_number_unsigned() ||
+                l_priority.get<uint64_t>() >
+                    std::numeric_limits<uint8_t>::max())
+            {
+                o_errCode = error_code::INVALID_JSON;
+                return constants::COLLECTION_PRIORITY_DEFAULT;
+            }
+
+            return l_priority.get<uint8_t>();
+        }
+
+        if (l_baseFru.value("essentialFru", false))
+        {
+            return constants::COLLECTION_PRIORITY_ESSENTIAL;
+        }
+
+        if (l_baseFru.value("powerOffOnly", false))
+        {
+            return constants::COLLECTION_PRIORITY_POWER_OFF_ONLY;
+        }
+
+        for (const auto& l_fru : l_fruList)
+        {
+            if (l_fru.value("inherit", false) || l_fru.contains("copyRecords"))
+            {
+                return constants::COLLECTION_PRIORITY_DEPENDENCY;
+            }
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+    }
+
+    return constants::COLLECTION_PRIORITY_DEFAULT;
+}
+
+/**
+ * @brief API to get timeout of VPD read on EEPROM of a FRU.
+ *
+ * Timeout is taken from "readTimeoutMs" tag of the FRU, if present.
+ *
+ * @param[in] i_sysCfgJsonObj - System config JSON object.
+ * @param[in] i_vpdFruPath - EEPROM path.
+ * @param[out] o_errCode - To set error code for the error.
+ *
+ * @return Read timeout. constants::EEPROM_READ_TIMEOUT_MS if tag is not
+ * present or in case of error.
+ */
+inline std::chrono::milliseconds getEepromReadTimeout(
+    const nlohmann::json& i_sysCfgJsonObj, const std::string& i_vpdFruPath,
+    uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    const std::chrono::milliseconds l_defaultTimeout(
+        constants::EEPROM_READ_TIMEOUT_MS);
+
+    if (i_vpdFruPath.empty())
+    {
+        o_errCode = error_code::INVALID_INPUT_PARAMETER;
+        return l_defaultTimeout;
+    }
+
+    if (!i_sysCfgJsonObj.contains("frus"))
+    {
+        o_errCode = error_code::INVALID_JSON;
+        return l_defaultTimeout;
+    }
+
+    if (!i_sysCfgJsonObj["frus"].contains(i_vpdFruPath))
+    {
+        o_errCode = error_code::FRU_PATH_NOT_FOUND;
+        return l_defaultTimeout;
+    }
+
+    try
+    {
+        const nlohmann::json& l_baseFru =
+            i_sysCfgJsonObj["frus"][i_vpdFruPath].at(0);
+
+        if (l_baseFru.contains("readTimeoutMs"))
+        {
+            return std::chrono::milliseconds(
+                l_baseFru["readTimeoutMs"].get<uint32_t>());
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+    }
+
+    return l_defaultTimeout;
+}
+
 /**
  * @brief API which tells if the FRU is replaceable at runtime
  *
@@ -12,9 +12,16 @@
 #include <utility/dbus_utility.hpp>
 #include <utility/event_logger_utility.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
 #include <regex>
+#include <thread>
 #include <typeindex>
 
 namespace vpd
@@ -533,6 +540,210 @@ inline void getVpdDataInVector(const std::string& vpdFilePath,
     }
 }
 
+/**
+ * @brief An API to get VPD in a vector, within a time limit.
+ *
+ * Read on an EEPROM blocks in kernel till the bus transaction is over, and
+ * poll on the EEPROM file always reports it readable. So the read is done in
+ * a detached thread, which is abandoned if the read is not over in time. The
+ * abandoned thread exits whenever the read returns.
+ *
+ * @param[in] i_vpdFilePath - EEPROM path of the FRU.
+ * @param[out] o_vpdVector - VPD in vector form.
+ * @param[in] i_vpdStartOffset - Offset of VPD data in EEPROM.
+ * @param[in] i_timeout - Time to wait for the read to be over.
+ * @param[in] i_onReadOver - Called from the reader thread once the read
+ * returns, even if it was abandoned, before the result is handed over. Can be
+ * empty.
+ * @param[out] o_errCode - To set error code in case of error.
+ */
+inline void getVpdDataInVectorWithTimeout(
+    const std::string& i_vpdFilePath, types::BinaryVector& o_vpdVector,
+    size_t i_vpdStartOffset, std::chrono::milliseconds i_timeout,
+    std::function<void()> i_onReadOver, uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+
+    using ReadResult = std::pair<types::BinaryVector, uint16_t>;
+
+    try
+    {
+        // Shared with the reader thread, which can outlive this call.
+        auto l_readResult = std::make_shared<std::promise<ReadResult>>();
+        std::future<ReadResult> l_futureResult = l_readResult->get_future();
+
+        std::thread([l_readResult, l_vpdFilePath = i_vpdFilePath,
+                     l_vpdStartOffset = i_vpdStartOffset,
+                     l_onReadOver = std::move(i_onReadOver)]() mutable {
+            ReadResult l_result;
+            try
+            {
+                getVpdDataInVector(l_vpdFilePath, l_result.first,
+                                   l_vpdStartOffset, l_result.second);
+            }
+            catch (const std::exception& l_ex)
+            {
+                l_result.second = error_code::STANDARD_EXCEPTION;
+            }
+
+            if (l_onReadOver)
+            {
+                try
+                {
+                    l_onReadOver();
+                }
+                catch (const std::exception& l_ex)
+                {
+                    // Nothing to do, read result is still handed over.
+                }
+            }
+            l_readResult->set_value(std::move(l_result));
+        }).detach();
+
+        if (l_futureResult.wait_for(i_timeout) == std::future_status::timeout)
+        {
+            o_errCode = error_code::EEPROM_READ_TIMEOUT;
+            return;
+        }
+
+        ReadResult l_result = l_futureResult.get();
+        o_vpdVector = std::move(l_result.first);
+        o_errCode = l_result.second;
+    }
+    catch (const std::exception& l_ex)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+    }
+}
+
+/**
+ * @brief API to get write page size of a FRU's EEPROM.
+ *
+ * Page size is taken from "writePageSize" tag of the FRU in config JSON, if
+ * present. Otherwise it is read from "pagesize" property of the EEPROM's
+ * device tree node, as used by at24 driver.
+ *
+ * @param[in] i_sysCfgJsonObj - System config JSON object, can be empty.
+ * @param[in] i_vpdFilePath - EEPROM path.
+ * @param[out] o_errCode - To set error code in case of error.
+ *
+ * @return Write page size. constants::EEPROM_WRITE_PAGE_SIZE if it is not
+ * known or in case of error.
+ */
+inline size_t getEepromWritePageSize(const nlohmann::json& i_sysCfgJsonObj,
+                                     const std::string& i_vpdFilePath,
+                                     uint16_t& o_errCode) noexcept
+{
+    o_errCode = 0;
+    if (i_vpdFilePath.empty())
+    {
+        o_errCode = error_code::INVALID_INPUT_PARAMETER;
+        return constants::EEPROM_WRITE_PAGE_SIZE;
+    }
+
+    try
+    {
+        if (i_sysCfgJsonObj.contains("frus") &&
+            i_sysCfgJsonObj["frus"].contains(i_vpdFilePath))
+        {
+            const nlohmann::json& l_baseFru =
+                i_sysCfgJsonObj["frus"][i_vpdFilePath].at(0);
+
+            if (l_baseFru.contains("writePageSize"))
+            {
+                return std::max(l_baseFru["writePageSize"].get<size_t>(),
+                                size_t{1});
+            }
+        }
+
+        // Device tree property is a big endian 32 bit value.
+        const std::filesystem::path l_pageSizePath =
+            std::filesystem::path(i_vpdFilePath).parent_path() / "of_node" /
+            "pagesize";
+
+        std::ifstream l_pageSizeFile(l_pageSizePath, std::ios::binary);
+        std::array<uint8_t, 4> l_pageSize{};
+        if (l_pageSizeFile.read(reinterpret_cast<char*>(l_pageSize.data()),
+                                l_pageSize.size()))
+        {
+            const size_t l_value =
+                (size_t{l_pageSize[0]} << 24) | (size_t{l_pageSize[1]} << 16) |
+                (size_t{l_pageSize[2]} << 8) | size_t{l_pageSize[3]};
+
+            if (l_value != 0)
+            {
+                return l_value;
+            }
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+    }
+
+    return constants::EEPROM_WRITE_PAGE_SIZE;
+}
+
+/**
+ * @brief API to get writes required for a list of changed ranges of VPD.
+ *
+ * Ranges are aligned to EEPROM write pages. Ranges falling in the same page
+ * are merged into one write, covering the unchanged bytes in between, and a
+ * range spanning pages is split on page boundary. So each write touches a
+ * single page and each page is written at most once.
+ *
+ * @param[in] i_changedRanges - List of (offset, length) of changed ranges,
+ * relative to start of VPD. Ranges can be unordered and can overlap.
+ * @param[in] i_vpdStartOffset - Offset of VPD in EEPROM.
+ * @param[in] i_pageSize - Write page size of the EEPROM.
+ *
+ * @return List of (offset, length) of writes relative to start of VPD, in
+ * order of offset.
+ */
+inline std::vector<std::pair<size_t, size_t>> getPageAlignedWrites(
+    std::vector<std::pair<size_t, size_t>> i_changedRanges,
+    size_t i_vpdStartOffset, size_t i_pageSize)
+{
+    const size_t l_pageSize = std::max(i_pageSize, size_t{1});
+    std::ranges::sort(i_changedRanges);
+
+    // Writes are held as [begin, end).
+    std::vector<std::pair<size_t, size_t>> l_writes;
+    for (const auto& [l_offset, l_length] : i_changedRanges)
+    {
+        const size_t l_end = l_offset + l_length;
+
+        for (size_t l_begin = l_offset; l_begin < l_end;)
+        {
+            const size_t l_page = (i_vpdStartOffset + l_begin) / l_pageSize;
+            const size_t l_pageEnd =
+                (l_page + 1) * l_pageSize - i_vpdStartOffset;
+            const size_t l_writeEnd = std::min(l_end, l_pageEnd);
+
+            if (!l_writes.empty() &&
+                (i_vpdStartOffset + l_writes.back().first) / l_pageSize ==
+                    l_page)
+            {
+                l_writes.back().second =
+                    std::max(l_writes.back().second, l_writeEnd);
+            }
+            else
+            {
+                l_writes.emplace_back(l_begin, l_writeEnd);
+            }
+
+            l_begin = l_writeEnd;
+        }
+    }
+
+    for (auto& [l_begin, l_end] : l_writes)
+    {
+        l_end -= l_begin;
+    }
+
+    return l_writes;
+}
+
 /**
  * @brief An API to get D-bus representation of given VPD keyword.
  *
@@ -643,6 +854,92 @@ inline bool findCcinInVpd(const nlohmann::json& i_JsonObject,
     return l_rc;
 }
 
+/**
+ * @brief API to check if an interface holds VPD related data.
+ *
+ * @param[in] i_interface - Interface name.
+ *
+ * @return true if interface holds VPD related data, false otherwise.
+ */
+inline bool isVpdRelatedInterface(const std::string& i_interface) noexcept
+{
+    static const std::vector<std::string> l_vpdRelatedInterfaces{
+        constants::operationalStatusInf, constants::inventoryItemInf,
+        constants::assetInf, constants::vpdCollectionInterface};
+
+    return (i_interface.find(constants::ipzVpdInf) != std::string::npos &&
+            i_interface != constants::locationCodeInf) ||
+           (std::find(l_vpdRelatedInterfaces.begin(),
+                      l_vpdRelatedInterfaces.end(), i_interface) !=
+            l_vpdRelatedInterfaces.end());
+}
+
+/**
+ * @brief API to get reset value of properties of an interface.
+ *
+ * @param[in] i_propertyValueMap - Properties and their current value.
+ * @param[in] i_clearPresence - Indicates whether to clear present property or
+ * not.
+ *
+ * @return Properties and their reset value.
+ */
+inline types::PropertyMap getResetPropertyMap(
+    const types::PropertyMap& i_propertyValueMap, bool i_clearPresence)
+{
+    types::PropertyMap l_propertyMap;
+
+    for (const auto& l_aProperty : i_propertyValueMap)
+    {
+        const std::string& l_propertyName = l_aProperty.first;
+        const auto& l_propertyValue = l_aProperty.second;
+
+        if (std::holds_alternative<types::BinaryVector>(l_propertyValue))
+        {
+            l_propertyMap.emplace(l_propertyName, types::BinaryVector{});
+        }
+        else if (std::holds_alternative<std::string>(l_propertyValue))
+        {
+            if (l_propertyName.compare("Status") == constants::STR_CMP_SUCCESS)
+            {
+                l_propertyMap.emplace(l_propertyName,
+                                      constants::vpdCollectionNotStarted);
+                l_propertyMap.emplace("StartTime", 0);
+                l_propertyMap.emplace("CompletedTime", 0);
+            }
+            else if (l_propertyName.compare("PrettyName") ==
+                     constants::STR_CMP_SUCCESS)
+            {
+                // The FRU name is constant and independent of its presence
+                // state. So, it should not get reset.
+                continue;
+            }
+            else
+            {
+                l_propertyMap.emplace(l_propertyName, std::string{});
+            }
+        }
+        else if (std::holds_alternative<bool>(l_propertyValue))
+        {
+            if (l_propertyName.compare("Present") ==
+                constants::STR_CMP_SUCCESS)
+            {
+                if (i_clearPresence)
+                {
+                    l_propertyMap.emplace(l_propertyName, false);
+                }
+            }
+            else if (l_propertyName.compare("Functional") ==
+                     constants::STR_CMP_SUCCESS)
+            {
+                // Since FRU is not present functional property is considered
+                // as true.
+                l_propertyMap.emplace(l_propertyName, true);
+            }
+        }
+    }
+    return l_propertyMap;
+}
+
 /**
  * @brief API to reset data of a FRU populated under PIM.
  *
@@ -667,97 +964,55 @@ inline void resetDataUnderPIM(const std::string& i_objectPath,
 
     try
     {
-        std::vector<std::string> l_interfaces;
-        const types::MapperGetObject& l_getObjectMap =
-            dbusUtility::getObjectMap(i_objectPath, l_interfaces);
+        const std::vector<std::string> l_interfaceList =
+            dbusUtility::getPimHostedInterfaces(i_objectPath);
 
-        const std::vector<std::string>& l_vpdRelatedInterfaces{
-            constants::operationalStatusInf, constants::inventoryItemInf,
-            constants::assetInf, constants::vpdCollectionInterface};
-
-        for (const auto& [l_service, l_interfaceList] : l_getObjectMap)
+        for (const auto& l_interface : l_interfaceList)
         {
-            if (l_service.compare(constants::pimServiceName) !=
-                constants::STR_CMP_SUCCESS)
+            if (isVpdRelatedInterface(l_interface))
             {
-                continue;
+                const types::PropertyMap& l_propertyValueMap =
+                    dbusUtility::getPropertyMap(constants::pimServiceName,
+                                                i_objectPath, l_interface);
+
+                io_interfaceMap.emplace(
+                    l_interface,
+                    getResetPropertyMap(l_propertyValueMap, i_clearPresence));
             }
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        o_errCode = error_code::STANDARD_EXCEPTION;
+    }
+}
 
-            for (const auto& l_interface : l_interfaceList)
+/**
+ * @brief API to reset data of a FRU populated under PIM, from a snapshot.
+ *
+ * Same as the other overload, but the FRU's data under PIM is taken from the
+ * given snapshot, instead of being read from D-Bus.
+ *
+ * @param[in] i_pimInterfaceMap - FRU's interfaces and properties under PIM.
+ * @param[in] io_interfaceMap - Interface and its properties map.
+ * @param[in] i_clearPresence - Indicates whether to clear present property or
+ * not.
+ * @param[out] o_errCode - To set error code in case of error.
+ */
+inline void resetDataUnderPIM(const types::InterfaceMap& i_pimInterfaceMap,
+                              types::InterfaceMap& io_interfaceMap,
+                              bool i_clearPresence, uint16_t& o_errCode)
+{
+    o_errCode = 0;
+    try
+    {
+        for (const auto& [l_interface, l_propertyValueMap] : i_pimInterfaceMap)
+        {
+            if (isVpdRelatedInterface(l_interface))
             {
-                if ((l_interface.find(constants::ipzVpdInf) !=
-                         std::string::npos &&
-                     l_interface != constants::locationCodeInf) ||
-                    ((std::find(l_vpdRelatedInterfaces.begin(),
-                                l_vpdRelatedInterfaces.end(), l_interface)) !=
-                     l_vpdRelatedInterfaces.end()))
-                {
-                    const types::PropertyMap& l_propertyValueMap =
-                        dbusUtility::getPropertyMap(l_service, i_objectPath,
-                                                    l_interface);
-
-                    types::PropertyMap l_propertyMap;
-
-                    for (const auto& l_aProperty : l_propertyValueMap)
-                    {
-                        const std::string& l_propertyName = l_aProperty.first;
-                        const auto& l_propertyValue = l_aProperty.second;
-
-                        if (std::holds_alternative<types::BinaryVector>(
-                                l_propertyValue))
-                        {
-                            l_propertyMap.emplace(l_propertyName,
-                                                  types::BinaryVector{});
-                        }
-                        else if (std::holds_alternative<std::string>(
-                                     l_propertyValue))
-                        {
-                            if (l_propertyName.compare("Status") ==
-                                constants::STR_CMP_SUCCESS)
-                            {
-                                l_propertyMap.emplace(
-                                    l_propertyName,
-                                    constants::vpdCollectionNotStarted);
-                                l_propertyMap.emplace("StartTime", 0);
-                                l_propertyMap.emplace("CompletedTime", 0);
-                            }
-                            else if (l_propertyName.compare("PrettyName") ==
-                                     constants::STR_CMP_SUCCESS)
-                            {
-                                // The FRU name is constant and independent of
-                                // its presence state. So, it should not get
-                                // reset.
-                                continue;
-                            }
-                            else
-                            {
-                                l_propertyMap.emplace(l_propertyName,
-                                                      std::string{});
-                            }
-                        }
-                        else if (std::holds_alternative<bool>(l_propertyValue))
-                        {
-                            if (l_propertyName.compare("Present") ==
-                                constants::STR_CMP_SUCCESS)
-                            {
-                                if (i_clearPresence)
-                                {
-                                    l_propertyMap.emplace(l_propertyName,
-                                                          false);
-                                }
-                            }
-                            else if (l_propertyName.compare("Functional") ==
-                                     constants::STR_CMP_SUCCESS)
-                            {
-                                // Since FRU is not present functional property
-                                // is considered as true.
-                                l_propertyMap.emplace(l_propertyName, true);
-                            }
-                        }
-                    }
-                    io_interfaceMap.emplace(l_interface,
-                                            std::move(l_propertyMap));
-                }
+                io_interfaceMap.emplace(
+                    l_interface,
+                    getResetPropertyMap(l_propertyValueMap, i_clearPresence));
             }
         }
     }
@@ -938,20 +1193,21 @@ inline bool isPowerVsImage()
 }
 
 /**
- * @brief API to sync keyword update to inherited FRUs.
+ * @brief API to sync keywords update to inherited FRUs.
  *
- * For a given keyword update on a EEPROM path, this API syncs the keyword
- * update to all inherited FRUs' respective interface, property on PIM.
+ * For a given list of keywords updated on a EEPROM path, this API syncs the
+ * keywords update to all inherited FRUs' respective interface, property on
+ * PIM, with a single call.
  *
  * @param[in] i_fruPath - EEPROM path of FRU.
- * @param[in] i_paramsToWriteData - Input details.
+ * @param[in] i_paramsToWriteData - List of input details.
  * @param[in] i_sysCfgJsonObj - System config JSON.
  * @param[out] o_errCode - To set error code in case of error.
  *
  */
 inline void updateKwdOnInheritedFrus(
     const std::string& i_fruPath,
-    const types::WriteVpdParams& i_paramsToWriteData,
+    const types::ListOfWriteVpdParams& i_paramsToWriteData,
     const nlohmann::json& i_sysCfgJsonObj, uint16_t& o_errCode) noexcept
 {
     o_errCode = 0;
@@ -975,14 +1231,6 @@ inline void updateKwdOnInheritedFrus(
             return;
         }
 
-        const types::IpzData* l_ipzData =
-            std::get_if<types::IpzData>(&i_paramsToWriteData);
-
-        if (!l_ipzData)
-        {
-            o_errCode = error_code::UNSUPPORTED_VPD_TYPE;
-            return;
-        }
         //  iterate through all inventory paths for given EEPROM path,
         //  except the base FRU.
         //  if for an inventory path, "inherit" tag is true,
@@ -991,26 +1239,41 @@ inline void updateKwdOnInheritedFrus(
 
         types::ObjectMap l_objectInterfaceMap;
 
-        auto l_populateInterfaceMap =
-            [&l_objectInterfaceMap,
-             &l_ipzData = std::as_const(l_ipzData)](const auto& l_Fru) {
-                // update inherited FRUs only
-                if (l_Fru.value("inherit", true))
-                {
-                    l_objectInterfaceMap.emplace(
-                        sdbusplus::message::object_path{l_Fru["inventoryPath"]},
-                        types::InterfaceMap{
-                            {std::string{constants::ipzVpdInf +
-                                         std::get<0>(*l_ipzData)},
-                             types::PropertyMap{{std::get<1>(*l_ipzData),
-                                                 std::get<2>(*l_ipzData)}}}});
-                }
-            };
+        for (const auto& l_paramsToWrite : i_paramsToWriteData)
+        {
+            const types::IpzData* l_ipzData =
+                std::get_if<types::IpzData>(&l_paramsToWrite);
 
-        // iterate through all FRUs except the base FRU
-        std::for_each(
-            i_sysCfgJsonObj["frus"][i_fruPath].begin() + constants::VALUE_1,
-            i_sysCfgJsonObj["frus"][i_fruPath].end(), l_populateInterfaceMap);
+            if (!l_ipzData)
+            {
+                o_errCode = error_code::UNSUPPORTED_VPD_TYPE;
+                return;
+            }
+
+            auto l_populateInterfaceMap =
+                [&l_objectInterfaceMap,
+                 &l_ipzData = std::as_const(l_ipzData)](const auto& l_Fru) {
+                    // update inherited FRUs only
+                    if (l_Fru.value("inherit", true))
+                    {
+                        const sdbusplus::message::object_path l_objectPath{
+                            l_Fru["inventoryPath"]};
+                        types::InterfaceMap& l_interfaceMap =
+                            l_objectInterfaceMap[l_objectPath];
+
+                        l_interfaceMap[constants::ipzVpdInf +
+                                       std::get<0>(*l_ipzData)]
+                                      [std::get<1>(*l_ipzData)] =
+                                          std::get<2>(*l_ipzData);
+                    }
+                };
+
+            // iterate through all FRUs except the base FRU
+            std::for_each(i_sysCfgJsonObj["frus"][i_fruPath].begin() +
+                              constants::VALUE_1,
+                          i_sysCfgJsonObj["frus"][i_fruPath].end(),
+                          l_populateInterfaceMap);
+        }
 
         if (!l_objectInterfaceMap.empty())
         {
@@ -1029,6 +1292,28 @@ inline void updateKwdOnInheritedFrus(
     }
 }
 
+/**
+ * @brief API to sync keyword update to inherited FRUs.
+ *
+ * For a given keyword update on a EEPROM path, this API syncs the keyword
+ * update to all inherited FRUs' respective interface, property on PIM.
+ *
+ * @param[in] i_fruPath - EEPROM path of FRU.
+ * @param[in] i_paramsToWriteData - Input details.
+ * @param[in] i_sysCfgJsonObj - System config JSON.
+ * @param[out] o_errCode - To set error code in case of error.
+ *
+ */
+inline void updateKwdOnInheritedFrus(
+    const std::string& i_fruPath,
+    const types::WriteVpdParams& i_paramsToWriteData,
+    const nlohmann::json& i_sysCfgJsonObj, uint16_t& o_errCode) noexcept
+{
+    updateKwdOnInheritedFrus(
+        i_fruPath, types::ListOfWriteVpdParams{i_paramsToWriteData},
+        i_sysCfgJsonObj, o_errCode);
+}
+
 /**
  * @brief API to get common interface(s) properties corresponding to given
  * record and keyword.
@@ -1128,20 +1413,21 @@ inline types::InterfaceMap getCommonInterfaceProperties(
 }
 
 /**
- * @brief API to update common interface(s) properties when keyword is updated.
+ * @brief API to update common interface(s) properties when keywords are
+ * updated.
  *
- * For a given keyword update on a EEPROM path, this API syncs the keyword
- * update to respective common interface(s) properties of the base FRU and all
- * inherited FRUs.
+ * For a given list of keywords updated on a EEPROM path, this API syncs the
+ * keywords update to respective common interface(s) properties of the base
+ * FRU and all inherited FRUs, with a single call.
  *
  * @param[in] i_fruPath - EEPROM path of FRU.
- * @param[in] i_paramsToWriteData - Input details.
+ * @param[in] i_paramsToWriteData - List of input details.
  * @param[in] i_sysCfgJsonObj - System config JSON.
  * @param[out] o_errCode - To set error code in case of error.
  */
 inline void updateCiPropertyOfInheritedFrus(
     const std::string& i_fruPath,
-    const types::WriteVpdParams& i_paramsToWriteData,
+    const types::ListOfWriteVpdParams& i_paramsToWriteData,
     const nlohmann::json& i_sysCfgJsonObj, uint16_t& o_errCode) noexcept
 {
     o_errCode = 0;
@@ -1171,35 +1457,49 @@ inline void updateCiPropertyOfInheritedFrus(
             return;
         }
 
-        if (!std::get_if<types::IpzData>(&i_paramsToWriteData))
-        {
-            o_errCode = error_code::UNSUPPORTED_VPD_TYPE;
-            return;
-        }
-
-        //  iterate through all inventory paths for given EEPROM path,
-        //  if for an inventory path, "inherit" tag is true,
-        //  update the inventory path's com.ibm.ipzvpd.<record>,keyword
-        //  property
+        // Common interface(s) properties of all the keywords.
+        types::InterfaceMap l_interfaceMap;
 
-        types::ObjectMap l_objectInterfaceMap;
+        for (const auto& l_paramsToWrite : i_paramsToWriteData)
+        {
+            if (!std::get_if<types::IpzData>(&l_paramsToWrite))
+            {
+                o_errCode = error_code::UNSUPPORTED_VPD_TYPE;
+                return;
+            }
 
-        const types::InterfaceMap l_interfaceMap = getCommonInterfaceProperties(
-            i_paramsToWriteData, i_sysCfgJsonObj["commonInterfaces"],
-            o_errCode);
+            const types::InterfaceMap l_kwdInterfaceMap =
+                getCommonInterfaceProperties(
+                    l_paramsToWrite, i_sysCfgJsonObj["commonInterfaces"],
+                    o_errCode);
 
-        if (l_interfaceMap.empty())
-        {
             if (o_errCode)
             {
                 logging::logMessage(
                     "Failed to get common interface property list, error : " +
                     commonUtility::getErrCodeMsg(o_errCode));
+                o_errCode = 0;
+            }
+
+            for (const auto& [l_interface, l_propertyMap] : l_kwdInterfaceMap)
+            {
+                l_interfaceMap[l_interface].insert(l_propertyMap.begin(),
+                                                   l_propertyMap.end());
             }
+        }
+
+        if (l_interfaceMap.empty())
+        {
             // nothing to do
             return;
         }
 
+        //  iterate through all inventory paths for given EEPROM path,
+        //  if for an inventory path, "inherit" tag is true,
+        //  update the inventory path's common interface(s) properties
+
+        types::ObjectMap l_objectInterfaceMap;
+
         auto l_populateObjectInterfaceMap =
             [&l_objectInterfaceMap, &l_interfaceMap = std::as_const(
                                         l_interfaceMap)](const auto& l_Fru) {
@@ -1232,6 +1532,28 @@ inline void updateCiPropertyOfInheritedFrus(
     }
 }
 
+/**
+ * @brief API to update common interface(s) properties when keyword is updated.
+ *
+ * For a given keyword update on a EEPROM path, this API syncs the keyword
+ * update to respective common interface(s) properties of the base FRU and all
+ * inherited FRUs.
+ *
+ * @param[in] i_fruPath - EEPROM path of FRU.
+ * @param[in] i_paramsToWriteData - Input details.
+ * @param[in] i_sysCfgJsonObj - System config JSON.
+ * @param[out] o_errCode - To set error code in case of error.
+ */
+inline void updateCiPropertyOfInheritedFrus(
+    const std::string& i_fruPath,
+    const types::WriteVpdParams& i_paramsToWriteData,
+    const nlohmann::json& i_sysCfgJsonObj, uint16_t& o_errCode) noexcept
+{
+    updateCiPropertyOfInheritedFrus(
+        i_fruPath, types::ListOfWriteVpdParams{i_paramsToWriteData},
+        i_sysCfgJsonObj, o_errCode);
+}
+
 /**
  * @brief API to convert write VPD parameters to a string.
  *
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "io_scheduler.hpp"
+#include "parser_factory.hpp"
+#include "parser_interface.hpp"
+#include "types.hpp"
+
+#include <utility/common_utility.hpp>
+#include <utility/vpd_specific_utility.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace vpd
+{
+/**
+ * @brief Class to cache VPD of EEPROMs for keyword read and write.
+ *
+ * VPD of an EEPROM is read once and held along with its parser, so that the
+ * indices the parser builds on the VPD are reused by later reads and writes
+ * of keywords. Parser refers to the held VPD instead of a copy of it, and
+ * applies the bytes it writes and verifies on hardware to it. So the held VPD
+ * stays same as hardware as long as the EEPROM is written only through the
+ * cache, and keyword reads are served from it without any EEPROM I/O.
+ *
+ * Operations on an EEPROM are serialized, operations on different EEPROMs run
+ * in parallel. If an I/O scheduler is set, an operation holds a slot on the
+ * EEPROM's bus, as it may read or write the EEPROM, including rewrite of
+ * record ECC. VPD of an EEPROM must be invalidated whenever the EEPROM is
+ * collected again or its FRU is removed.
+ */
+class VpdCache
+{
+  public:
+    /**
+     * List of deleted methods.
+     */
+    VpdCache(const VpdCache&) = delete;
+    VpdCache& operator=(const VpdCache&) = delete;
+    VpdCache(VpdCache&&) = delete;
+    VpdCache& operator=(VpdCache&&) = delete;
+
+    /**
+     * @brief Method to get instance of VpdCache class.
+     */
+    static VpdCache& getVpdCacheInstance()
+    {
+        static VpdCache l_vpdCache;
+        return l_vpdCache;
+    }
+
+    /**
+     * @brief API to execute an operation on cached VPD of an EEPROM.
+     *
+     * VPD is read from the EEPROM if not cached. Cached VPD is dropped if the
+     * operation throws, as it can't be trusted to be same as hardware then.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_vpdStartOffset - Offset from where VPD starts in EEPROM.
+     * @param[in] i_writePageSize - Write page size of the EEPROM.
+     * @param[in] i_operation - Operation taking the parser of VPD.
+     *
+     * @throw Exception thrown while reading or parsing VPD, or by the
+     * operation. std::runtime_error without waiting for the EEPROM's bus, if
+     * it has an abandoned I/O.
+     *
+     * @return Value returned by the operation.
+     */
+    template <typename Operation>
+    auto execute(const std::string& i_vpdFilePath, size_t i_vpdStartOffset,
+                 size_t i_writePageSize, Operation&& i_operation)
+    {
+        const std::shared_ptr<Entry> l_entry = getEntry(i_vpdFilePath);
+
+        std::scoped_lock l_lock(l_entry->m_mutex);
+
+        std::unique_ptr<IoScheduler::IoSlot> l_ioSlot;
+        if (const auto l_ioScheduler = getIoScheduler())
+        {
+            l_ioSlot = l_ioScheduler->acquireIoSlot(i_vpdFilePath);
+        }
+
+        try
+        {
+            if (l_entry->m_parser == nullptr ||
+                l_entry->m_vpdStartOffset != i_vpdStartOffset)
+            {
+                load(*l_entry, i_vpdStartOffset, i_writePageSize);
+            }
+
+            return i_operation(*l_entry->m_parser);
+        }
+        catch (const std::exception& l_ex)
+        {
+            l_entry->m_parser.reset();
+            l_entry->m_vpdVector.clear();
+            throw;
+        }
+    }
+
+    /**
+     * @brief API to invalidate cached VPD of an EEPROM.
+     *
+     * Waits for the operation in progress on the EEPROM, if any.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     */
+    void invalidate(const std::string& i_vpdFilePath) noexcept
+    {
+        std::shared_ptr<Entry> l_entry;
+        {
+            std::scoped_lock l_lock(m_entriesMutex);
+            if (auto l_itr = m_entries.find(i_vpdFilePath);
+                l_itr != m_entries.end())
+            {
+                l_entry = l_itr->second;
+            }
+        }
+
+        if (l_entry != nullptr)
+        {
+            std::scoped_lock l_lock(l_entry->m_mutex);
+            l_entry->m_parser.reset();
+            l_entry->m_vpdVector.clear();
+        }
+    }
+
+    /**
+     * @brief API to set I/O scheduler for the EEPROM I/O of operations.
+     *
+     * @param[in] i_ioScheduler - I/O scheduler, null to not schedule I/O.
+     */
+    void setIoScheduler(std::shared_ptr<IoScheduler> i_ioScheduler) noexcept
+    {
+        std::scoped_lock l_lock(m_entriesMutex);
+        m_ioScheduler = std::move(i_ioScheduler);
+    }
+
+  private:
+    /**
+     * @brief Constructor
+     */
+    VpdCache() = default;
+
+    /**
+     * @brief API to get I/O scheduler for the EEPROM I/O of operations.
+     *
+     * @return I/O scheduler, null if not set.
+     */
+    std::shared_ptr<IoScheduler> getIoScheduler() noexcept
+    {
+        std::scoped_lock l_lock(m_entriesMutex);
+        return m_ioScheduler;
+    }
+
+    /**
+     * @brief Structure of cached VPD of an EEPROM.
+     */
+    struct Entry
+    {
+        // Mutex to serialize operations on the EEPROM.
+        std::mutex m_mutex;
+
+        // EEPROM path, referred to by parser.
+        std::string m_vpdFilePath;
+
+        // Offset from where VPD starts in EEPROM.
+        size_t m_vpdStartOffset = 0;
+
+        // VPD of the EEPROM, referred to and updated on write by parser. The
+        // only copy of the VPD held for the EEPROM.
+        types::BinaryVector m_vpdVector;
+
+        // Parser of the VPD, null if VPD is not cached.
+        std::shared_ptr<ParserInterface> m_parser;
+    };
+
+    /**
+     * @brief API to get entry of an EEPROM, creating it if not present.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     *
+     * @return Entry of the EEPROM.
+     */
+    std::shared_ptr<Entry> getEntry(const std::string& i_vpdFilePath)
+    {
+        std::scoped_lock l_lock(m_entriesMutex);
+
+        auto& l_entry = m_entries[i_vpdFilePath];
+        if (l_entry == nullptr)
+        {
+            l_entry = std::make_shared<Entry>();
+            l_entry->m_vpdFilePath = i_vpdFilePath;
+        }
+
+        return l_entry;
+    }
+
+    /**
+     * @brief API to read VPD of an EEPROM and create its parser.
+     *
+     * @param[in,out] io_entry - Entry of the EEPROM.
+     * @param[in] i_vpdStartOffset - Offset from where VPD starts in EEPROM.
+     * @param[in] i_writePageSize - Write page size of the EEPROM.
+     *
+     * @throw std::runtime_error, DataException
+     */
+    static void load(Entry& io_entry, size_t i_vpdStartOffset,
+                     size_t i_writePageSize)
+    {
+        io_entry.m_parser.reset();
+        io_entry.m_vpdStartOffset = i_vpdStartOffset;
+
+        uint16_t l_errCode = 0;
+        vpdSpecificUtility::getVpdDataInVector(io_entry.m_vpdFilePath,
+                                               io_entry.m_vpdVector,
+                                               i_vpdStartOffset, l_errCode);
+
+        if (l_errCode)
+        {
+            throw std::runtime_error(
+                "Failed to get VPD in vector for " + io_entry.m_vpdFilePath +
+                ", error : " + commonUtility::getErrCodeMsg(l_errCode));
+        }
+
+        io_entry.m_parser = ParserFactory::getParser(
+            io_entry.m_vpdVector, io_entry.m_vpdFilePath, i_vpdStartOffset,
+            i_writePageSize);
+    }
+
+    // Cached VPD of EEPROMs, by EEPROM path.
+    std::unordered_map<std::string, std::shared_ptr<Entry>> m_entries;
+
+    // I/O scheduler for the EEPROM I/O of operations, can be null.
+    std::shared_ptr<IoScheduler> m_ioScheduler;
+
+    // Mutex to guard the map of entries and the I/O scheduler.
+    std::mutex m_entriesMutex;
+};
+} // namespace vpd
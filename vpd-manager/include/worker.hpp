@@ -1,15 +1,22 @@
 #pragma once
 
+#include "bounded_queue.hpp"
 #include "constants.hpp"
+#include "io_scheduler.hpp"
 #include "logger.hpp"
 #include "types.hpp"
 
 #include <nlohmann/json.hpp>
 
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <optional>
-#include <semaphore>
 #include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace vpd
 {
@@ -44,9 +51,12 @@ class Worker
      * initialize the parsed JSON variable.
      *
      * @param[in] pathToConfigJSON - Path to the config JSON, if applicable.
-     * @param[in] i_maxThreadCount - Maximum thread while collecting FRUs VPD.
+     * @param[in] i_maxThreadCount - Maximum threads reading EEPROMs while
+     * collecting FRUs VPD.
      * @param[in] i_vpdCollectionMode - Mode in which VPD collection should take
      * place.
+     * @param[in] i_sysCfgJsonObj - Already parsed config JSON, if any. When
+     * passed, the JSON is shared and not parsed again from pathToConfigJSON.
      *
      * Note: Throws std::exception in case of construction failure. Caller needs
      * to handle to detect successful object creation.
@@ -54,7 +64,8 @@ class Worker
     Worker(std::string pathToConfigJson = std::string(),
            uint8_t i_maxThreadCount = constants::MAX_THREADS,
            types::VpdCollectionMode i_vpdCollectionMode =
-               types::VpdCollectionMode::DEFAULT_MODE);
+               types::VpdCollectionMode::DEFAULT_MODE,
+           std::shared_ptr<const nlohmann::json> i_sysCfgJsonObj = nullptr);
 
     /**
      * @brief Destructor
@@ -65,7 +76,13 @@ class Worker
      * @brief API to process all FRUs presnt in config JSON file.
      *
      * This API based on config JSON passed/selected for the system, will
-     * trigger parser for all the FRUs and publish it on DBus.
+     * trigger parser for all the FRUs and publish it on DBus. FRUs are
+     * triggered in order of their collection priority and FRUs of the same
+     * priority in an order which spreads EEPROM I/O across buses.
+     *
+     * Collection is pipelined, EEPROM reads, parsing and publishing on DBus of
+     * different FRUs overlap. The API returns once the pipeline is launched,
+     * use isAllFruCollectionDone to know when it is over.
      *
      * Note: Config JSON file path should be passed to worker class constructor
      * to make use of this API.
@@ -97,6 +114,8 @@ class Worker
     /**
      * @brief An API to delete FRU VPD over DBus.
      *
+     * Takes the VPD access mutex exclusively, caller must not hold it.
+     *
      * @param[in] i_dbusObjPath - Dbus object path of the FRU.
      *
      * @throw std::runtime_error if given input path is empty.
@@ -116,41 +135,85 @@ class Worker
     /**
      * @brief API to get system config JSON object
      *
-     * @return System config JSON object.
+     * The JSON is immutable and shared, not copied. Holding the returned
+     * pointer keeps the JSON alive.
+     *
+     * @return System config JSON object, never null. Empty JSON if processing
+     * is not based on any config JSON.
      */
-    inline nlohmann::json getSysCfgJsonObj() const
+    inline std::shared_ptr<const nlohmann::json> getSysCfgJsonObj() const
     {
-        return m_parsedJson;
+        return m_sysCfgJsonObj;
     }
 
     /**
-     * @brief API to get active thread count.
+     * @brief API to get mutex guarding VPD and FRU state.
      *
-     * Each FRU is collected in a separate thread. This API gives the active
-     * thread collecting FRU's VPD at any given time.
+     * Mutex is shared by all the modules accessing VPD, so that they are
+     * serialized the same way. It is taken shared by lookups, reads and the
+     * collection pipeline, exclusive by keyword writes, single FRU VPD
+     * collection and deletion.
      *
-     * @return Count of active threads.
+     * @return Mutex guarding VPD and FRU state.
      */
-    size_t getActiveThreadCount() const
+    static std::shared_mutex& getVpdAccessMutex() noexcept
     {
-        return m_activeCollectionThreadCount;
+        static std::shared_mutex l_vpdAccessMutex;
+        return l_vpdAccessMutex;
     }
 
     /**
-     * @brief API to get list of EEPROMs for which thread creation failed.
+     * @brief API to get count of FRUs with collection in progress.
      *
-     * This API returns reference to list of EEPROM paths for which VPD
-     * collection thread creation has failed. Manager needs to process this list
-     * of EEPROMs and take appropriate action.
+     * FRUs are collected through a pipeline of I/O, parse and publish stages.
+     * This API gives the number of FRUs yet to come out of the pipeline.
      *
-     * @return reference to list of EEPROM paths for which VPD collection thread
-     * creation has failed
+     * @return Count of FRUs with collection in progress.
      */
-    inline std::forward_list<std::string>& getFailedEepromPaths() noexcept
+    size_t getActiveThreadCount() const
     {
-        return m_failedEepromPaths;
+        return m_activeCollectionThreadCount;
     }
 
+    /**
+     * @brief API to take list of EEPROMs which could not be collected.
+     *
+     * The list holds EEPROM paths which could not be taken through VPD
+     * collection pipeline, e.g. on thread creation failure, or which failed
+     * collection with an error worth a retry, e.g. I2C error on read. The list
+     * is emptied, EEPROMs failing again get added back.
+     *
+     * @return List of EEPROM paths which could not be collected.
+     */
+    std::forward_list<std::string> takeFailedEepromPaths();
+
+    /**
+     * @brief API to enable retry of FRU VPD collection.
+     *
+     * Once enabled, a FRU failing collection with an error worth a retry is
+     * only added to the list of failed EEPROMs, till its retries are
+     * exhausted. Its failure is handled only then, clearing its data, logging
+     * PEL and marking it not present.
+     *
+     * @param[in] i_onRetryPending - Called once a collection, recollection or
+     * retry is over and the list of failed EEPROMs is not empty. Called from a
+     * collection thread, unless nothing was to be collected.
+     */
+    void enableFruCollectionRetry(
+        const std::function<void()>& i_onRetryPending);
+
+    /**
+     * @brief API to get number of retries of VPD collection of an EEPROM.
+     *
+     * Count is reset once collection of the EEPROM succeeds or its failure is
+     * handled.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     *
+     * @return Number of retries.
+     */
+    uint8_t getFruCollectionRetryCount(const std::string& i_vpdFilePath);
+
     /**
      * @brief API to get VPD collection mode
      *
@@ -167,6 +230,8 @@ class Worker
      * current state of the system matches with the state at which the FRU is
      * allowed for VPD recollection.
      *
+     * Takes the VPD access mutex exclusively, caller must not hold it.
+     *
      * @param[in] i_dbusObjPath - D-bus object path
      */
     void collectSingleFruVpd(
@@ -176,22 +241,205 @@ class Worker
      * @brief  Perform VPD recollection
      * This api will trigger parser to perform VPD recollection for FRUs that
      * can be replaced at standby.
+     *
+     * FRUs are recollected through the same pipeline as collectFrusFromJson.
+     * The API returns once the pipeline is launched, progress of each FRU is
+     * reflected in its collection status.
+     *
+     * @param[in] i_onRecollectionDone - Called from a collection thread once
+     * recollection of all the FRUs is over, with the list of EEPROMs which
+     * failed recollection, including those to be retried. Can be empty.
+     *
+     * @return true if recollection is launched, false otherwise.
      */
-    void performVpdRecollection();
+    bool performVpdRecollection(
+        const std::function<void(const std::vector<std::string>&)>&
+            i_onRecollectionDone = nullptr);
+
+    /**
+     * @brief API to retry VPD collection of a list of EEPROMs.
+     *
+     * EEPROMs are collected through the same pipeline as collectFrusFromJson
+     * and can overlap a collection in progress. The API returns once the
+     * pipeline is launched.
+     *
+     * @param[in] i_eepromsToRetry - List of EEPROM paths.
+     */
+    void retryFruCollection(const std::vector<std::string>& i_eepromsToRetry);
 
   private:
     /**
-     * @brief An API to parse and publish a FRU VPD over D-Bus.
+     * @brief API to collect VPD of a list of EEPROMs.
+     *
+     * EEPROMs are fed to the collection pipeline in order of their collection
+     * priority. The API returns once the pipeline is launched.
+     *
+     * @param[in] i_eepromsToCollect - List of EEPROM paths.
+     * @param[in] i_onCollectionDone - Called once collection of all the
+     * EEPROMs is over, from a collection thread unless the list is empty. Can
+     * be empty.
+     */
+    void collectFrus(const std::vector<std::string>& i_eepromsToCollect,
+                     const std::function<void()>& i_onCollectionDone);
+
+    /**
+     * @brief API to run I/O stage of FRU VPD collection pipeline.
+     *
+     * Picks EEPROMs from the queue till it is closed, reads their VPD and
+     * passes it to the parse stage. Read on an EEPROM is throttled by the
+     * I/O scheduler based on the bus it sits on.
+     *
+     * @param[in] i_eepromQueue - Queue of EEPROMs to collect.
+     * @param[out] o_parseQueue - Queue of VPD to be parsed.
+     */
+    void runCollectionIoStage(
+        BoundedQueue<std::string>& i_eepromQueue,
+        BoundedQueue<types::EepromVpdData>& o_parseQueue);
+
+    /**
+     * @brief API to run parse stage of FRU VPD collection pipeline.
+     *
+     * Parses the VPD read by the I/O stage and populates the D-Bus data to be
+     * published by the publish stage.
+     *
+     * @param[in] i_parseQueue - Queue of VPD to be parsed.
+     * @param[out] o_publishQueue - Queue of D-Bus data to be published.
+     */
+    void runCollectionParseStage(
+        BoundedQueue<types::EepromVpdData>& i_parseQueue,
+        BoundedQueue<types::EepromObjectMap>& o_publishQueue);
+
+    /**
+     * @brief API to run publish stage of FRU VPD collection pipeline.
+     *
+     * D-Bus data of the FRUs waiting in the queue are merged and published
+     * with a single call to PIM, up to
+     * constants::COLLECTION_PUBLISH_BATCH_SIZE FRUs at a time. FRUs of a batch
+     * which fails to publish are published one by one.
+     *
+     * @param[in] i_publishQueue - Queue of D-Bus data to be published.
+     */
+    void runCollectionPublishStage(
+        BoundedQueue<types::EepromObjectMap>& i_publishQueue);
+
+    /**
+     * @brief API to launch threads of a collection pipeline stage.
+     *
+     * @param[in] i_threadCount - Number of threads to run the stage.
+     * @param[in] i_stage - Stage to run on each thread.
+     * @param[in] i_onStageDone - Called once by the last thread finishing the
+     * stage, or if none of the threads could be launched.
+     */
+    void launchCollectionStage(size_t i_threadCount,
+                               const std::function<void()>& i_stage,
+                               const std::function<void()>& i_onStageDone);
+
+    /**
+     * @brief API to read VPD of an EEPROM for collection.
+     *
+     * Executes pre action of the FRU, if required, and reads VPD of the EEPROM
+     * holding an I/O slot on the EEPROM's bus.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[out] o_vpdVector - VPD read from the EEPROM.
+     * @param[out] o_vpdStartOffset - Offset from where VPD starts in EEPROM.
+     *
+     * @throw std::runtime_error
+     *
+     * @return true if VPD is read, false if FRU is not present or EEPROM
+     * doesn't exist.
+     */
+    bool readVpdForCollection(const std::string& i_vpdFilePath,
+                              types::BinaryVector& o_vpdVector,
+                              size_t& o_vpdStartOffset);
+
+    /**
+     * @brief API to parse VPD read for collection.
+     *
+     * Executes post action of the FRU, if required, after parsing.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_vpdVector - VPD read from the EEPROM.
+     * @param[in] i_vpdStartOffset - Offset from where VPD starts in EEPROM.
+     *
+     * @throw DataException, EccException, std::runtime_error
+     *
+     * @return Parsed VPD.
+     */
+    types::VPDMapVariant parseVpdForCollection(
+        const std::string& i_vpdFilePath, types::BinaryVector& i_vpdVector,
+        size_t i_vpdStartOffset);
+
+    /**
+     * @brief API to handle failure in parsing VPD of an EEPROM.
+     *
+     * Re-throws the exception with the EEPROM path added to its message. Post
+     * fail action of the FRU is left to the caller, as a failure during
+     * collection can still be retried.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_ex - Exception caught while parsing.
+     *
+     * @throw DataException, EccException or std::runtime_error, based on the
+     * exception caught.
+     */
+    [[noreturn]] void throwParsingFailure(const std::string& i_vpdFilePath,
+                                          const std::exception& i_ex) const;
+
+    /**
+     * @brief API to mark VPD collection of a FRU as completed.
      *
-     * Note: This API will handle all the exceptions internally and will only
-     * return status of parsing and publishing of VPD over D-Bus.
+     * If no VPD is found for the FRU, its stale data on PIM is cleared.
      *
-     * @param[in] i_vpdFilePath - Path of file containing VPD.
-     * @return Tuple of status and file path. Status, true if successfull else
-     * false.
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_isVpdEmpty - true if no VPD is found for the FRU.
      */
-    std::tuple<bool, std::string> parseAndPublishVPD(
-        const std::string& i_vpdFilePath);
+    void onFruCollectionSuccess(const std::string& i_vpdFilePath,
+                                bool i_isVpdEmpty = false);
+
+    /**
+     * @brief API to mark VPD collection of a FRU as failed.
+     *
+     * Executes post fail action of the FRU, if required, clears stale data of
+     * the FRU on PIM, logs PEL based on the failure and marks the FRU as not
+     * present. If the failure is worth a retry and the
+     * FRU has retries left, the FRU is only added to the list of failed
+     * EEPROMs instead.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     * @param[in] i_ex - Exception caught while collecting VPD.
+     */
+    void onFruCollectionFailure(const std::string& i_vpdFilePath,
+                                const std::exception& i_ex);
+
+    /**
+     * @brief API to add a FRU to the list of failed EEPROMs.
+     *
+     * Used when a FRU could not be taken through the collection pipeline.
+     *
+     * @param[in] i_vpdFilePath - EEPROM path.
+     */
+    void onFruCollectionDropped(const std::string& i_vpdFilePath);
+
+    /**
+     * @brief API to mark a run of the collection pipeline as over.
+     *
+     * Calls the caller's callback, then the callback registered for failed
+     * EEPROMs pending a retry, if there are any.
+     *
+     * @param[in] i_onCollectionDone - Caller's callback, can be empty.
+     */
+    void onFruCollectionDone(const std::function<void()>& i_onCollectionDone);
+
+    /**
+     * @brief API to merge D-Bus data of a batch of FRUs.
+     *
+     * @param[in] i_batch - List of EEPROM path and D-Bus data of its FRU.
+     *
+     * @return D-Bus data of all the FRUs, to be published with a single call.
+     */
+    types::ObjectMap getBatchedObjectMap(
+        const std::vector<types::EepromObjectMap>& i_batch) const;
 
     /**
      * @brief An API to process extrainterfaces w.r.t a FRU.
@@ -443,6 +691,21 @@ class Worker
                i_fru.value("handlePresence", true);
     }
 
+    /**
+     * @brief API to get the config JSON to be used by the object.
+     *
+     * @param[in] i_configJsonPath - Path to the config JSON, can be empty.
+     * @param[in] i_sysCfgJsonObj - Already parsed config JSON, can be null.
+     *
+     * @throw JsonException
+     *
+     * @return Given parsed JSON if not null, else JSON parsed from the given
+     * path. Empty JSON if path is also empty.
+     */
+    static std::shared_ptr<const nlohmann::json> getSysCfgJson(
+        const std::string& i_configJsonPath,
+        std::shared_ptr<const nlohmann::json> i_sysCfgJsonObj);
+
     /**
      * @brief API to check and execute post fail action if needed.
      *
@@ -458,13 +721,16 @@ class Worker
         const std::string& i_vpdFilePath,
         const std::string& i_flowFlag) const noexcept;
 
-    // Parsed JSON file.
-    nlohmann::json m_parsedJson{};
-
     // Path to config JSON if applicable.
-    std::string& m_configJsonPath;
+    const std::string m_configJsonPath;
+
+    // Parsed JSON file, shared with the modules requiring it.
+    const std::shared_ptr<const nlohmann::json> m_sysCfgJsonObj;
 
-    // Keeps track of active thread(s) doing VPD collection.
+    // Parsed JSON file, refers to the JSON held by m_sysCfgJsonObj.
+    const nlohmann::json& m_parsedJson;
+
+    // Keeps track of FRUs with VPD collection in progress.
     size_t m_activeCollectionThreadCount = 0;
 
     // Holds status, if VPD collection has been done or not.
@@ -472,15 +738,36 @@ class Worker
     // collection. It just states, if the VPD collection process is over or not.
     bool m_isAllFruCollected = false;
 
-    // Mutex to guard critical resource m_activeCollectionThreadCount.
+    // Holds if VPD recollection is in progress.
+    std::atomic<bool> m_isRecollectionInProgress{false};
+
+    // Mutex to guard critical resources m_activeCollectionThreadCount,
+    // m_failedEepromPaths, FRU collection retry state and recollection state.
     std::mutex m_mutex;
 
-    // Counting semaphore to limit the number of threads.
-    std::counting_semaphore<constants::MAX_THREADS> m_semaphore;
+    // Number of threads reading EEPROMs during collection.
+    const uint8_t m_ioStageThreadCount;
 
-    // List of EEPROM paths for which VPD collection thread creation has failed.
+    // Scheduler to limit concurrent EEPROM I/O per bus.
+    std::shared_ptr<IoScheduler> m_ioScheduler;
+
+    // List of EEPROM paths which could not be taken through VPD collection or
+    // failed collection with an error worth a retry.
     std::forward_list<std::string> m_failedEepromPaths;
 
+    // Called once a collection run is over with failed EEPROMs pending a
+    // retry, empty if retry is not enabled.
+    std::function<void()> m_onFruCollectionRetryPending;
+
+    // Map of EEPROM path to number of retries of its VPD collection.
+    std::unordered_map<std::string, uint8_t> m_fruCollectionRetryCount;
+
+    // EEPROMs under VPD recollection, which have not failed it so far.
+    std::unordered_set<std::string> m_eepromsUnderRecollection;
+
+    // EEPROMs which failed VPD recollection in progress.
+    std::vector<std::string> m_failedRecollectionEeproms;
+
     // VPD collection mode
     types::VpdCollectionMode m_vpdCollectionMode{
         types::VpdCollectionMode::DEFAULT_MODE};
@@ -6,12 +6,16 @@
 #include "listener.hpp"
 #include "logger.hpp"
 #include "parser.hpp"
+#include "single_fab.hpp"
+#include "tracer.hpp"
 
 #include <utility/common_utility.hpp>
 #include <utility/dbus_utility.hpp>
 #include <utility/json_utility.hpp>
 #include <utility/vpd_specific_utility.hpp>
 
+#include <algorithm>
+
 namespace vpd
 {
 IbmHandler::IbmHandler(
@@ -26,7 +30,8 @@ IbmHandler::IbmHandler(
     m_interface(i_iFace), m_progressInterface(i_progressiFace),
     m_ioContext(i_ioCon), m_asioConnection(i_asioConnection),
     m_logger(Logger::getLoggerInstance()),
-    m_vpdCollectionMode(i_vpdCollectionMode)
+    m_vpdCollectionMode(i_vpdCollectionMode),
+    m_fruCollectionRetryTimer(*i_ioCon)
 {
     try
     {
@@ -36,6 +41,12 @@ IbmHandler::IbmHandler(
         // Set up minimal things that is needed before bus name is claimed.
         performInitialSetup();
 
+        if (m_isInvalidSystemConfig)
+        {
+            // No point proceeding, service needs to be quiesced.
+            throw std::runtime_error("Invalid system configuration found.");
+        }
+
         // Init back up and restore.
         initBackupAndRestore();
 
@@ -43,8 +54,8 @@ IbmHandler::IbmHandler(
         initEventListeners();
 
         // Instantiate GpioMonitor class
-        m_gpioMonitor = std::make_shared<GpioMonitor>(m_sysCfgJsonObj, m_worker,
-                                                      m_ioContext);
+        m_gpioMonitor = std::make_shared<GpioMonitor>(
+            getSysCfgJsonSnapshot(), m_worker, m_ioContext);
     }
     catch (const std::exception& l_ec)
     {
@@ -103,9 +114,16 @@ void IbmHandler::initWorker()
             l_threadCount = constants::MAX_THREADS;
         }
 
-        // Initialize worker with required parameters.
+        // Initialize worker with required parameters. Worker shares the JSON
+        // already selected and parsed, instead of parsing it again.
         m_worker = std::make_shared<Worker>(m_configJsonPath, l_threadCount,
-                                            m_vpdCollectionMode);
+                                            m_vpdCollectionMode,
+                                            getSysCfgJsonSnapshot());
+        // Failed EEPROMs are processed on the event loop.
+        m_worker->enableFruCollectionRetry([this]() {
+            boost::asio::post(*m_ioContext,
+                              [this]() { processFailedEeproms(); });
+        });
     }
     catch (const std::exception& l_ex)
     {
@@ -137,7 +155,8 @@ void IbmHandler::initBackupAndRestore() noexcept
         // place in inital set up flow.
         if ((m_backupAndRestoreObj == nullptr))
         {
-            if (m_sysCfgJsonObj.empty())
+            const auto l_sysCfgJsonObj = getSysCfgJsonSnapshot();
+            if (l_sysCfgJsonObj->empty())
             {
                 // Throwing as sysconfig JSON empty is not expected at this
                 // point of execution and also not having backup and restore
@@ -147,7 +166,7 @@ void IbmHandler::initBackupAndRestore() noexcept
                     m_configJsonPath);
             }
 
-            if (!jsonUtility::isBackupAndRestoreRequired(m_sysCfgJsonObj,
+            if (!jsonUtility::isBackupAndRestoreRequired(*l_sysCfgJsonObj,
                                                          l_errCode))
             {
                 if (l_errCode)
@@ -165,7 +184,7 @@ void IbmHandler::initBackupAndRestore() noexcept
             }
 
             m_backupAndRestoreObj =
-                std::make_shared<BackupAndRestore>(m_sysCfgJsonObj);
+                std::make_shared<BackupAndRestore>(l_sysCfgJsonObj);
         }
     }
     catch (const std::exception& l_ex)
@@ -191,6 +210,7 @@ void IbmHandler::initEventListeners() noexcept
             std::make_shared<Listener>(m_worker, m_asioConnection);
         m_eventListener->registerAssetTagChangeCallback();
         m_eventListener->registerHostStateChangeCallback();
+        m_eventListener->registerSystemStateChangeCallback();
         m_eventListener->registerPresenceChangeCallback();
     }
     catch (const std::exception& l_ex)
@@ -232,7 +252,7 @@ void IbmHandler::SetTimerToDetectVpdCollectionStatus()
         {
             // cancel the timer
             l_timer.cancel();
-            processFailedEeproms();
+            Tracer::getTracerInstance().stopTrace();
 
             // update VPD for powerVS system.
             ConfigurePowerVsSystem();
@@ -251,12 +271,13 @@ void IbmHandler::SetTimerToDetectVpdCollectionStatus()
             {
                 // Check if system config JSON specifies
                 // correlatedPropertiesJson
-                if (m_sysCfgJsonObj.contains("correlatedPropertiesConfigPath"))
+                const auto l_sysCfgJsonObj = getSysCfgJsonSnapshot();
+                if (l_sysCfgJsonObj->contains("correlatedPropertiesConfigPath"))
                 {
                     // register correlated properties callback with specific
                     // correlated properties JSON
                     m_eventListener->registerCorrPropCallBack(
-                        m_sysCfgJsonObj["correlatedPropertiesConfigPath"]);
+                        (*l_sysCfgJsonObj)["correlatedPropertiesConfigPath"]);
                 }
                 else
                 {
@@ -275,6 +296,7 @@ void IbmHandler::SetTimerToDetectVpdCollectionStatus()
             if (l_timerRetry == MAX_RETRY)
             {
                 l_timer.cancel();
+                Tracer::getTracerInstance().stopTrace();
                 logging::logMessage("Taking too long. Active thread = " +
                                     std::to_string(l_threadCount));
 #ifdef ENABLE_FILE_LOGGING
@@ -300,11 +322,11 @@ void IbmHandler::checkAndUpdatePowerVsVpd(
 {
     for (const auto& [l_fruPath, l_recJson] : i_powerVsJsonObj.items())
     {
-        nlohmann::json l_sysCfgJsonObj{};
-        if (m_worker.get() != nullptr)
-        {
-            l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
-        }
+        const auto l_sysCfgJsonSnapshot =
+            (m_worker.get() != nullptr)
+                ? m_worker->getSysCfgJsonObj()
+                : std::make_shared<const nlohmann::json>();
+        const nlohmann::json& l_sysCfgJsonObj = *l_sysCfgJsonSnapshot;
 
         // The utility method will handle emty JSON case. No explicit
         // handling required here.
@@ -406,7 +428,7 @@ void IbmHandler::checkAndUpdatePowerVsVpd(
 
                 // Update part number only if required.
                 std::shared_ptr<Parser> l_parserObj =
-                    std::make_shared<Parser>(l_fruPath, l_sysCfgJsonObj);
+                    std::make_shared<Parser>(l_fruPath, l_sysCfgJsonSnapshot);
                 if (l_parserObj->updateVpdKeyword(std::make_tuple(
                         l_recordName, l_kwdName, l_binaryKwdValue)) ==
                     constants::FAILURE)
@@ -494,33 +516,117 @@ void IbmHandler::ConfigurePowerVsSystem()
 
 void IbmHandler::processFailedEeproms()
 {
-    if (m_worker.get() != nullptr)
+    if (m_worker.get() == nullptr)
     {
-        // TODO:
-        // - iterate through list of EEPROMs for which thread creation has
-        // failed
-        // - For each failed EEPROM, trigger VPD collection
-        m_worker->getFailedEepromPaths().clear();
+        return;
+    }
+
+    const auto l_currentTime = std::chrono::steady_clock::now();
+
+    for (const auto& l_eepromPath : m_worker->takeFailedEepromPaths())
+    {
+        const uint8_t l_retryCount =
+            m_worker->getFruCollectionRetryCount(l_eepromPath);
+        if (l_retryCount >= constants::FRU_COLLECTION_MAX_RETRIES)
+        {
+            m_logger->logMessage(
+                "VPD collection of [" + l_eepromPath + "] failed after " +
+                    std::to_string(l_retryCount) + " retries, giving up.",
+                PlaceHolder::COLLECTION);
+            continue;
+        }
+
+        const auto l_delay = std::chrono::seconds(
+            std::min(constants::FRU_COLLECTION_RETRY_BASE_DELAY_SEC
+                         << l_retryCount,
+                     constants::FRU_COLLECTION_RETRY_MAX_DELAY_SEC));
+
+        // An EEPROM reported more than once keeps its earlier schedule.
+        m_fruCollectionRetryDueTime.emplace(l_eepromPath,
+                                            l_currentTime + l_delay);
+    }
+
+    scheduleFruCollectionRetry();
+}
+
+void IbmHandler::scheduleFruCollectionRetry()
+{
+    if (m_fruCollectionRetryDueTime.empty())
+    {
+        return;
+    }
+
+    const auto l_earliestRetry = std::min_element(
+        m_fruCollectionRetryDueTime.begin(), m_fruCollectionRetryDueTime.end(),
+        [](const auto& i_lhs, const auto& i_rhs) {
+            return i_lhs.second < i_rhs.second;
+        });
+
+    // Re-arming cancels any wait in progress.
+    m_fruCollectionRetryTimer.expires_at(l_earliestRetry->second);
+    m_fruCollectionRetryTimer.async_wait(
+        [this](const boost::system::error_code& i_errorCode) {
+            if (i_errorCode != boost::asio::error::operation_aborted)
+            {
+                retryDueFruCollection();
+            }
+        });
+}
+
+void IbmHandler::retryDueFruCollection() noexcept
+{
+    try
+    {
+        const auto l_currentTime = std::chrono::steady_clock::now();
+
+        std::vector<std::string> l_eepromsToRetry;
+        for (auto l_itr = m_fruCollectionRetryDueTime.begin();
+             l_itr != m_fruCollectionRetryDueTime.end();)
+        {
+            if (l_itr->second > l_currentTime)
+            {
+                ++l_itr;
+                continue;
+            }
+
+            l_eepromsToRetry.push_back(l_itr->first);
+            l_itr = m_fruCollectionRetryDueTime.erase(l_itr);
+        }
+
+        if (!l_eepromsToRetry.empty())
+        {
+            m_worker->retryFruCollection(l_eepromsToRetry);
+        }
+
+        scheduleFruCollectionRetry();
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage(
+            "Failed to retry VPD collection of failed EEPROMs, error: " +
+                std::string(l_ex.what()),
+            PlaceHolder::COLLECTION);
     }
 }
 
 void IbmHandler::enableMuxChips()
 {
-    if (m_sysCfgJsonObj.empty())
+    const auto l_sysCfgJsonObj = getSysCfgJsonSnapshot();
+    if (l_sysCfgJsonObj->empty())
     {
         // config JSON should not be empty at this point of execution.
         throw std::runtime_error("Config JSON is empty. Can't enable muxes");
         return;
     }
 
-    if (!m_sysCfgJsonObj.contains("muxes"))
+    if (!l_sysCfgJsonObj->contains("muxes"))
     {
         logging::logMessage("No mux defined for the system in config JSON");
         return;
     }
 
     // iterate over each MUX detail and enable them.
-    for (const auto& item : m_sysCfgJsonObj["muxes"])
+    for (const auto& item : (*l_sysCfgJsonObj)["muxes"])
     {
         uint16_t l_errCode = 0;
         if (item.contains("holdidlepath"))
@@ -685,7 +791,7 @@ bool IbmHandler::isBackupOnCache()
     {
         uint16_t l_errCode = 0;
         std::string l_backupAndRestoreCfgFilePath =
-            m_sysCfgJsonObj.value("backupRestoreConfigPath", "");
+            getSysCfgJsonSnapshot()->value("backupRestoreConfigPath", "");
 
         if (l_backupAndRestoreCfgFilePath.empty())
         {
@@ -731,14 +837,18 @@ bool IbmHandler::isBackupOnCache()
     return false;
 }
 
-void IbmHandler::performBackupAndRestore(types::VPDMapVariant& io_srcVpdMap)
+void IbmHandler::performBackupAndRestore(const std::string& i_systemVpdPath,
+                                         types::VPDMapVariant& io_srcVpdMap)
 {
     try
     {
         m_backupAndRestoreObj =
-            std::make_shared<BackupAndRestore>(m_sysCfgJsonObj);
-        auto [l_srcVpdVariant,
-              l_dstVpdVariant] = m_backupAndRestoreObj->backupAndRestore();
+            std::make_shared<BackupAndRestore>(getSysCfgJsonSnapshot());
+
+        // Share the already parsed system VPD instead of reading it again.
+        auto [l_srcVpdVariant, l_dstVpdVariant] =
+            m_backupAndRestoreObj->backupAndRestore(i_systemVpdPath,
+                                                    io_srcVpdMap);
 
         // ToDo: Revisit is this check is required or not.
         if (auto l_srcVpdMap = std::get_if<types::IPZVpdMap>(&l_srcVpdVariant);
@@ -936,9 +1046,9 @@ void IbmHandler::setDeviceTreeAndJson(
     types::VPDMapVariant& o_parsedSystemVpdMap)
 {
     // JSON is madatory for processing of this API.
-    if (m_sysCfgJsonObj.empty())
+    if (getSysCfgJsonSnapshot()->empty())
     {
-        throw JsonException("System config JSON is empty", m_sysCfgJsonObj);
+        throw JsonException("System config JSON is empty", m_configJsonPath);
     }
 
     uint16_t l_errCode = 0;
@@ -967,9 +1077,9 @@ void IbmHandler::setDeviceTreeAndJson(
         throw std::runtime_error(l_errMsg);
     }
 
-    // parse system VPD
+    // parse system VPD.
     std::shared_ptr<Parser> l_vpdParser =
-        std::make_shared<Parser>(l_systemVpdPath, m_sysCfgJsonObj);
+        std::make_shared<Parser>(l_systemVpdPath, getSysCfgJsonSnapshot());
     o_parsedSystemVpdMap = l_vpdParser->parse();
 
     if (std::holds_alternative<std::monostate>(o_parsedSystemVpdMap))
@@ -979,6 +1089,25 @@ void IbmHandler::setDeviceTreeAndJson(
             "]. Either file doesn't exist or error occurred while parsing the file.");
     }
 
+    recordBringUpPhase("system VPD read and parse");
+
+#ifdef IBM_SYSTEM_SINGLE_FAB
+    // IM is taken from the parsed system VPD only if it is read from planar,
+    // else planar is read by the override itself.
+    types::VPDMapVariant l_planarVpdNotParsed;
+    performSingleFabImOverride((l_systemVpdPath == SYSTEM_VPD_FILE_PATH)
+                                   ? o_parsedSystemVpdMap
+                                   : l_planarVpdNotParsed);
+
+    if (m_isInvalidSystemConfig)
+    {
+        throw std::runtime_error(
+            "Found an invalid system configuration. Needs manual intervention.");
+    }
+
+    recordBringUpPhase("single FAB IM override");
+#endif
+
     // Implies it is default JSON.
     std::string l_systemJson{JSON_ABSOLUTE_PATH_PREFIX};
 
@@ -992,7 +1121,7 @@ void IbmHandler::setDeviceTreeAndJson(
     }
 
     // re-parse the JSON once appropriate JSON has been selected.
-    m_sysCfgJsonObj = jsonUtility::getParsedJson(l_systemJson, l_errCode);
+    auto l_parsedJson = jsonUtility::getParsedJson(l_systemJson, l_errCode);
 
     if (l_errCode)
     {
@@ -1002,9 +1131,15 @@ void IbmHandler::setDeviceTreeAndJson(
             l_systemJson));
     }
 
+    // Publish the selected JSON as a new snapshot. JSON already shared is
+    // never modified, holders of the previous snapshot keep it alive.
+    const auto l_sysCfgJsonObj =
+        std::make_shared<const nlohmann::json>(std::move(l_parsedJson));
+    m_sysCfgJsonObj.store(l_sysCfgJsonObj);
+
     vpdSpecificUtility::setCollectionStatusProperty(
         SYSTEM_VPD_FILE_PATH, types::VpdCollectionStatus::InProgress,
-        m_sysCfgJsonObj, l_errCode);
+        *l_sysCfgJsonObj, l_errCode);
 
     if (l_errCode)
     {
@@ -1014,9 +1149,9 @@ void IbmHandler::setDeviceTreeAndJson(
     }
 
     std::string l_devTreeFromJson;
-    if (m_sysCfgJsonObj.contains("devTree"))
+    if (l_sysCfgJsonObj->contains("devTree"))
     {
-        l_devTreeFromJson = m_sysCfgJsonObj["devTree"];
+        l_devTreeFromJson = (*l_sysCfgJsonObj)["devTree"];
 
         if (l_devTreeFromJson.empty())
         {
@@ -1037,10 +1172,11 @@ void IbmHandler::setDeviceTreeAndJson(
         // Json or it is rightly set.
 
         setJsonSymbolicLink(l_systemJson);
+        recordBringUpPhase("system JSON selection");
 
         const std::string& l_systemVpdInvPath =
             jsonUtility::getInventoryObjPathFromJson(
-                m_sysCfgJsonObj, SYSTEM_VPD_FILE_PATH, l_errCode);
+                *l_sysCfgJsonObj, SYSTEM_VPD_FILE_PATH, l_errCode);
 
         if (l_systemVpdInvPath.empty())
         {
@@ -1065,9 +1201,10 @@ void IbmHandler::setDeviceTreeAndJson(
         if (!l_sysVpdObjMap.empty())
         {
             if (isBackupOnCache() && jsonUtility::isBackupAndRestoreRequired(
-                                         m_sysCfgJsonObj, l_errCode))
+                                         *l_sysCfgJsonObj, l_errCode))
             {
-                performBackupAndRestore(o_parsedSystemVpdMap);
+                performBackupAndRestore(l_systemVpdPath, o_parsedSystemVpdMap);
+                recordBringUpPhase("backup and restore");
             }
             else if (l_errCode)
             {
@@ -1085,13 +1222,40 @@ void IbmHandler::setDeviceTreeAndJson(
 #endif
 }
 
+void IbmHandler::performSingleFabImOverride(
+    [[maybe_unused]] types::VPDMapVariant& io_parsedPlanarVpd)
+{
+#ifdef IBM_SYSTEM_SINGLE_FAB
+    m_isSingleFabImOverrideDone = true;
+
+    if (dbusUtility::isChassisPowerOn())
+    {
+        return;
+    }
+
+    SingleFab l_singleFab;
+    if (l_singleFab.singleFabImOverride(io_parsedPlanarVpd) ==
+        constants::FAILURE)
+    {
+        m_isInvalidSystemConfig = true;
+    }
+#endif
+}
+
 void IbmHandler::performInitialSetup()
 {
+    // Trace covers system bring-up and collection of all the FRUs.
+    Tracer::getTracerInstance().startTrace();
+
+    m_bringUpPhaseTimings.clear();
+    m_bringUpPhaseStartTime = std::chrono::steady_clock::now();
+    const auto l_bringUpStartTime = m_bringUpPhaseStartTime;
+
     // Parse whatever JSON is set as of now.
     uint16_t l_errCode = 0;
     try
     {
-        m_sysCfgJsonObj =
+        auto l_parsedJson =
             jsonUtility::getParsedJson(m_configJsonPath, l_errCode);
 
         if (l_errCode)
@@ -1102,18 +1266,24 @@ void IbmHandler::performInitialSetup()
                                 m_configJsonPath);
         }
 
+        m_sysCfgJsonObj.store(
+            std::make_shared<const nlohmann::json>(std::move(l_parsedJson)));
+        recordBringUpPhase("config JSON parse");
+
         types::VPDMapVariant l_parsedSysVpdMap;
         setDeviceTreeAndJson(l_parsedSysVpdMap);
 
         // now that correct JSON is selected, initialize worker class.
         initWorker();
+        recordBringUpPhase("worker init");
 
         // proceed to publish system VPD.
         publishSystemVPD(l_parsedSysVpdMap);
+        recordBringUpPhase("system VPD publish");
 
         vpdSpecificUtility::setCollectionStatusProperty(
             SYSTEM_VPD_FILE_PATH, types::VpdCollectionStatus::Completed,
-            m_sysCfgJsonObj, l_errCode);
+            *getSysCfgJsonSnapshot(), l_errCode);
 
         if (l_errCode)
         {
@@ -1131,16 +1301,18 @@ void IbmHandler::performInitialSetup()
         // an issue seen with Castello cards, where the i2c line hangs on a
         // probe.
         enableMuxChips();
+        recordBringUpPhase("BMC position and mux enable");
 
         // Nothing needs to be done. Service restarted or BMC re-booted for
         // some reason at system power on.
     }
     catch (const std::exception& l_ex)
     {
+        recordBringUpPhase("failed phase");
         // Seeting of collection status should be utility method
         vpdSpecificUtility::setCollectionStatusProperty(
             SYSTEM_VPD_FILE_PATH, types::VpdCollectionStatus::Failed,
-            m_sysCfgJsonObj, l_errCode);
+            *getSysCfgJsonSnapshot(), l_errCode);
 
         if (l_errCode)
         {
@@ -1152,14 +1324,80 @@ void IbmHandler::performInitialSetup()
 
         // Any issue in system's inital set up is handled in this catch. Error
         // will not propogate to manager.
-        const types::PelInfoTuple l_pel(
-            EventLogger::getErrorType(l_ex), types::SeverityType::Critical, 0,
-            std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+        if (m_isInvalidSystemConfig)
+        {
+            // PEL is logged by single FAB IM override, manager will quiesce.
+            m_logger->logMessage(
+                std::string("Exception while performing initial set up. ") +
+                EventLogger::getErrorMsg(l_ex));
+        }
+        else
+        {
+            const types::PelInfoTuple l_pel(
+                EventLogger::getErrorType(l_ex), types::SeverityType::Critical,
+                0, std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+
+            m_logger->logMessage(
+                std::string("Exception while performing initial set up. ") +
+                    EventLogger::getErrorMsg(l_ex),
+                PlaceHolder::PEL, &l_pel);
+        }
 
+#ifdef IBM_SYSTEM_SINGLE_FAB
+        // Override doesn't depend on the steps of bring-up, so it is still
+        // performed if a step before it failed.
+        if (!m_isSingleFabImOverrideDone)
+        {
+            types::VPDMapVariant l_planarVpdNotParsed;
+            performSingleFabImOverride(l_planarVpdNotParsed);
+        }
+#endif
+    }
+
+    m_bringUpPhaseTimings.emplace_back(
+        "total", std::chrono::duration_cast<std::chrono::milliseconds>(
+                     std::chrono::steady_clock::now() - l_bringUpStartTime));
+    logBringUpPhaseTimings();
+}
+
+void IbmHandler::recordBringUpPhase(const std::string& i_phase) noexcept
+{
+    try
+    {
+        const auto l_now = std::chrono::steady_clock::now();
+        Tracer::getTracerInstance().recordSpan(
+            i_phase, "bring-up", m_bringUpPhaseStartTime, l_now);
+
+        m_bringUpPhaseTimings.emplace_back(
+            i_phase, std::chrono::duration_cast<std::chrono::milliseconds>(
+                         l_now - m_bringUpPhaseStartTime));
+        m_bringUpPhaseStartTime = l_now;
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage("Failed to record time of bring-up phase [" +
+                             i_phase + "], error : " + l_ex.what());
+    }
+}
+
+void IbmHandler::logBringUpPhaseTimings() noexcept
+{
+    try
+    {
+        std::string l_timings{"System bring-up phase timings:"};
+        for (const auto& [l_phase, l_duration] : m_bringUpPhaseTimings)
+        {
+            l_timings += " [" + l_phase + ": " +
+                         std::to_string(l_duration.count()) + " ms]";
+        }
+
+        m_logger->logMessage(l_timings, PlaceHolder::COLLECTION);
+    }
+    catch (const std::exception& l_ex)
+    {
         m_logger->logMessage(
-            std::string("Exception while performing initial set up. ") +
-                EventLogger::getErrorMsg(l_ex),
-            PlaceHolder::PEL, &l_pel);
+            "Failed to log bring-up phase timings, error : " +
+            std::string(l_ex.what()));
     }
 }
 
@@ -1224,7 +1462,8 @@ bool IbmHandler::isRbmcPrototypeSystem(uint16_t& o_errCode) const noexcept
 
 void IbmHandler::checkAndUpdateBmcPosition(size_t& o_bmcPosition) const noexcept
 {
-    if (m_sysCfgJsonObj.empty())
+    const auto l_sysCfgJsonObj = getSysCfgJsonSnapshot();
+    if (l_sysCfgJsonObj->empty())
     {
         m_logger->logMessage(
             "System config JSON is empty, unable to find BMC position");
@@ -1233,7 +1472,7 @@ void IbmHandler::checkAndUpdateBmcPosition(size_t& o_bmcPosition) const noexcept
 
     uint16_t l_errCode = 0;
     std::string l_motherboardEepromPath = jsonUtility::getFruPathFromJson(
-        m_sysCfgJsonObj, constants::systemVpdInvPath, l_errCode);
+        *l_sysCfgJsonObj, constants::systemVpdInvPath, l_errCode);
 
     if (!l_motherboardEepromPath.empty())
     {
@@ -6,9 +6,15 @@
 #include "logger.hpp"
 #include "worker.hpp"
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <sdbusplus/asio/object_server.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace vpd
 {
@@ -65,6 +71,19 @@ class IbmHandler
      */
     void collectAllFruVpd();
 
+    /**
+     * @brief API to check if system configuration is found invalid.
+     *
+     * System configuration is invalid if single FAB IM override fails during
+     * bring-up, in which case the service is expected to be quiesced.
+     *
+     * @return true if system configuration is invalid, false otherwise.
+     */
+    inline bool isInvalidSystemConfig() const noexcept
+    {
+        return m_isInvalidSystemConfig;
+    }
+
   private:
     /**
      * @brief API tocollect system VPD and set appropriate device tree and JSON.
@@ -73,6 +92,9 @@ class IbmHandler
      * If device tree change is required, it updates the "fitconfig" and reboots
      * the system. Else it is NOOP.
      *
+     * System VPD is read and parsed only once. The parsed VPD is shared with
+     * single FAB IM override, JSON selection and backup and restore.
+     *
      * @throw std::exception
      *
      * @param[out] o_parsedSystemVpdMap - Parsed system VPD map.
@@ -107,9 +129,11 @@ class IbmHandler
     /**
      * @brief An API to perform backup or restore of VPD.
      *
+     * @param[in] i_systemVpdPath - Path from where system VPD is parsed.
      * @param[in,out] io_srcVpdMap - Source VPD map.
      */
-    void performBackupAndRestore(types::VPDMapVariant& io_srcVpdMap);
+    void performBackupAndRestore(const std::string& i_systemVpdPath,
+                                 types::VPDMapVariant& io_srcVpdMap);
 
     /**
      *  @brief An API to parse and publish system VPD on D-Bus.
@@ -146,9 +170,27 @@ class IbmHandler
 
     /**
      * @brief API to process VPD collection thread failed EEPROMs.
+     *
+     * Collection of each failed EEPROM is scheduled for a retry on the event
+     * loop, after a delay which doubles with every retry of the EEPROM, till
+     * the retries of the EEPROM are exhausted. The API does not wait for the
+     * retries.
      */
     void processFailedEeproms();
 
+    /**
+     * @brief API to arm the timer for the earliest scheduled FRU collection
+     * retry.
+     */
+    void scheduleFruCollectionRetry();
+
+    /**
+     * @brief API to retry VPD collection of EEPROMs whose retry is due.
+     *
+     * EEPROMs failing again are processed once the retry is over.
+     */
+    void retryDueFruCollection() noexcept;
+
     /**
      * @brief API to check and update PowerVS VPD.
      *
@@ -178,6 +220,32 @@ class IbmHandler
      */
     void performInitialSetup();
 
+    /**
+     * @brief API to record time taken by a phase of system bring-up.
+     *
+     * Time since the end of the previous phase is recorded against the phase,
+     * and as a span in the collection trace.
+     *
+     * @param[in] i_phase - Name of the phase.
+     */
+    void recordBringUpPhase(const std::string& i_phase) noexcept;
+
+    /**
+     * @brief API to perform single FAB IM override.
+     *
+     * Override is performed only at chassis power off. System configuration
+     * is marked invalid if the override finds it so.
+     *
+     * @param[in,out] io_parsedPlanarVpd - Parsed planar VPD, kept in sync if
+     * IM is updated on planar. Planar is read if it holds no parsed VPD.
+     */
+    void performSingleFabImOverride(types::VPDMapVariant& io_parsedPlanarVpd);
+
+    /**
+     * @brief API to log time taken by each phase of system bring-up.
+     */
+    void logBringUpPhaseTimings() noexcept;
+
     /**
      * @brief Function to enable and bring MUX out of idle state.
      *
@@ -266,8 +334,24 @@ class IbmHandler
      */
     void setBmcPosition();
 
-    // Parsed system config json object.
-    nlohmann::json m_sysCfgJsonObj{};
+    /**
+     * @brief API to get system config JSON.
+     *
+     * JSON can get replaced any time, the returned snapshot must be used for
+     * all the reads which need to see the same JSON.
+     *
+     * @return System config JSON selected as of now.
+     */
+    inline std::shared_ptr<const nlohmann::json> getSysCfgJsonSnapshot()
+        const noexcept
+    {
+        return m_sysCfgJsonObj.load();
+    }
+
+    // Parsed system config json object. Shared and never modified, replaced
+    // as a whole when a different JSON gets selected.
+    std::atomic<std::shared_ptr<const nlohmann::json>> m_sysCfgJsonObj{
+        std::make_shared<const nlohmann::json>()};
 
     // Shared pointer to worker class
     std::shared_ptr<Worker>& m_worker;
@@ -307,5 +391,25 @@ class IbmHandler
 
     // To distinguish the factory reset path.
     bool m_isFactoryResetDone = false;
+
+    // Holds if system configuration is found invalid during bring-up.
+    bool m_isInvalidSystemConfig = false;
+
+    // Holds if single FAB IM override is performed during bring-up.
+    bool m_isSingleFabImOverrideDone = false;
+
+    // Start time of the system bring-up phase in progress.
+    std::chrono::steady_clock::time_point m_bringUpPhaseStartTime;
+
+    // Time taken by each completed phase of system bring-up, in order.
+    std::vector<std::pair<std::string, std::chrono::milliseconds>>
+        m_bringUpPhaseTimings;
+
+    // Map of EEPROM path to time at which its VPD collection is due a retry.
+    std::map<std::string, std::chrono::steady_clock::time_point>
+        m_fruCollectionRetryDueTime;
+
+    // Timer to retry VPD collection of failed EEPROMs.
+    boost::asio::steady_timer m_fruCollectionRetryTimer;
 };
 } // namespace vpd
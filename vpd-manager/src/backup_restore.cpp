@@ -16,11 +16,17 @@ namespace vpd
 BackupAndRestoreStatus BackupAndRestore::m_backupAndRestoreStatus =
     BackupAndRestoreStatus::NotStarted;
 
-BackupAndRestore::BackupAndRestore(const nlohmann::json& i_sysCfgJsonObj) :
+BackupAndRestore::BackupAndRestore(
+    const std::shared_ptr<const nlohmann::json>& i_sysCfgJsonObj) :
     m_sysCfgJsonObj(i_sysCfgJsonObj), m_logger(Logger::getLoggerInstance())
 {
+    if (!m_sysCfgJsonObj)
+    {
+        throw std::runtime_error("System config JSON is not available");
+    }
+
     std::string l_backupAndRestoreCfgFilePath =
-        i_sysCfgJsonObj.value("backupRestoreConfigPath", "");
+        m_sysCfgJsonObj->value("backupRestoreConfigPath", "");
 
     uint16_t l_errCode = 0;
     m_backupAndRestoreCfgJsonObj =
@@ -82,7 +88,7 @@ types::EepromInventoryPaths BackupAndRestore::getFruAndInvPaths(
     {
         uint16_t l_errCode{0};
         l_invObjPath = jsonUtility::getInventoryObjPathFromJson(
-            m_sysCfgJsonObj, l_fruPath, l_errCode);
+            *m_sysCfgJsonObj, l_fruPath, l_errCode);
 
         if (l_invObjPath.empty())
         {
@@ -105,7 +111,7 @@ types::EepromInventoryPaths BackupAndRestore::getFruAndInvPaths(
              !l_invObjPath.empty())
     {
         uint16_t l_errCode{0};
-        l_fruPath = jsonUtility::getFruPathFromJson(m_sysCfgJsonObj,
+        l_fruPath = jsonUtility::getFruPathFromJson(*m_sysCfgJsonObj,
                                                     l_invObjPath, l_errCode);
         if (l_fruPath.empty())
         {
@@ -134,7 +140,7 @@ std::tuple<std::string, std::string> BackupAndRestore::getSrcAndDstServiceName()
     uint16_t l_errCode{0};
 
     std::string l_srcServiceName =
-        jsonUtility::getServiceName(m_sysCfgJsonObj, m_srcInvPath, l_errCode);
+        jsonUtility::getServiceName(*m_sysCfgJsonObj, m_srcInvPath, l_errCode);
     if (l_errCode)
     {
         m_logger->logMessage("Failed to get source service name, error : " +
@@ -144,7 +150,7 @@ std::tuple<std::string, std::string> BackupAndRestore::getSrcAndDstServiceName()
     }
 
     std::string l_dstServiceName =
-        jsonUtility::getServiceName(m_sysCfgJsonObj, m_dstInvPath, l_errCode);
+        jsonUtility::getServiceName(*m_sysCfgJsonObj, m_dstInvPath, l_errCode);
     if (l_errCode)
     {
         m_logger->logMessage(
@@ -322,7 +328,9 @@ void BackupAndRestore::syncIpzData(
 }
 
 std::tuple<types::VPDMapVariant, types::VPDMapVariant>
-    BackupAndRestore::backupAndRestore()
+    BackupAndRestore::backupAndRestore(
+        const std::string& i_parsedFruPath,
+        const types::VPDMapVariant& i_parsedVpdMap)
 {
     auto l_emptyVariantPair =
         std::make_tuple(std::monostate{}, std::monostate{});
@@ -350,21 +358,40 @@ std::tuple<types::VPDMapVariant, types::VPDMapVariant>
                 "Failed to initiate backup and restore: unable to extract destination FRU or inventory path.");
         }
 
+        // VPD already parsed by the caller is not read from the EEPROM again.
+        const bool l_isParsedVpdAvailable =
+            !i_parsedFruPath.empty() &&
+            !std::holds_alternative<std::monostate>(i_parsedVpdMap);
+
         types::VPDMapVariant l_srcVpdVariant;
         if (m_backupAndRestoreCfgJsonObj["source"].contains("hardwarePath"))
         {
-            std::shared_ptr<Parser> l_vpdParser =
-                std::make_shared<Parser>(m_srcFruPath, m_sysCfgJsonObj);
-            l_srcVpdVariant = l_vpdParser->parse();
+            if (l_isParsedVpdAvailable && m_srcFruPath == i_parsedFruPath)
+            {
+                l_srcVpdVariant = i_parsedVpdMap;
+            }
+            else
+            {
+                std::shared_ptr<Parser> l_vpdParser =
+                    std::make_shared<Parser>(m_srcFruPath, m_sysCfgJsonObj);
+                l_srcVpdVariant = l_vpdParser->parse();
+            }
         }
 
         types::VPDMapVariant l_dstVpdVariant;
         if (m_backupAndRestoreCfgJsonObj["destination"].contains(
                 "hardwarePath"))
         {
-            std::shared_ptr<Parser> l_vpdParser =
-                std::make_shared<Parser>(m_dstFruPath, m_sysCfgJsonObj);
-            l_dstVpdVariant = l_vpdParser->parse();
+            if (l_isParsedVpdAvailable && m_dstFruPath == i_parsedFruPath)
+            {
+                l_dstVpdVariant = i_parsedVpdMap;
+            }
+            else
+            {
+                std::shared_ptr<Parser> l_vpdParser =
+                    std::make_shared<Parser>(m_dstFruPath, m_sysCfgJsonObj);
+                l_dstVpdVariant = l_vpdParser->parse();
+            }
         }
 
         // Implement backup and restore for IPZ type VPD
@@ -553,6 +580,14 @@ void BackupAndRestore::setBackupAndRestoreStatus(
 int BackupAndRestore::updateKeywordOnPrimaryOrBackupPath(
     const std::string& i_fruPath,
     const types::WriteVpdParams& i_paramsToWriteData) const noexcept
+{
+    return updateKeywordsOnPrimaryOrBackupPath(
+        i_fruPath, types::ListOfWriteVpdParams{i_paramsToWriteData});
+}
+
+int BackupAndRestore::updateKeywordsOnPrimaryOrBackupPath(
+    const std::string& i_fruPath,
+    const types::ListOfWriteVpdParams& i_paramsToWriteData) const noexcept
 {
     if (i_fruPath.empty())
     {
@@ -591,30 +626,34 @@ int BackupAndRestore::updateKeywordOnPrimaryOrBackupPath(
         return constants::SUCCESS;
     }
 
-    if (m_backupAndRestoreCfgJsonObj["backupMap"].is_array())
+    if (!m_backupAndRestoreCfgJsonObj["backupMap"].is_array())
     {
-        std::string l_inpRecordName;
-        std::string l_inpKeywordName;
-        types::BinaryVector l_inpKeywordValue;
+        return constants::SUCCESS;
+    }
 
-        if (const types::IpzData* l_ipzData =
-                std::get_if<types::IpzData>(&i_paramsToWriteData))
-        {
-            l_inpRecordName = std::get<0>(*l_ipzData);
-            l_inpKeywordName = std::get<1>(*l_ipzData);
-            l_inpKeywordValue = std::get<2>(*l_ipzData);
+    // Keywords to be updated on the other path, collected to update them in
+    // one go.
+    types::ListOfWriteVpdParams l_paramsToWriteOnOtherPath;
 
-            if (l_inpRecordName.empty() || l_inpKeywordName.empty() ||
-                l_inpKeywordValue.empty())
-            {
-                m_logger->logMessage("Invalid input received");
-                return constants::FAILURE;
-            }
-        }
-        else
+    for (const auto& l_paramsToWrite : i_paramsToWriteData)
+    {
+        const types::IpzData* l_ipzData =
+            std::get_if<types::IpzData>(&l_paramsToWrite);
+
+        if (l_ipzData == nullptr)
         {
             // only IPZ type VPD is supported now.
-            return constants::SUCCESS;
+            continue;
+        }
+
+        const auto& [l_inpRecordName, l_inpKeywordName, l_inpKeywordValue] =
+            *l_ipzData;
+
+        if (l_inpRecordName.empty() || l_inpKeywordName.empty() ||
+            l_inpKeywordValue.empty())
+        {
+            m_logger->logMessage("Invalid input received");
+            return constants::FAILURE;
         }
 
         for (const auto& l_aRecordKwInfo :
@@ -637,30 +676,46 @@ int BackupAndRestore::updateKeywordOnPrimaryOrBackupPath(
                 (l_srcRecordName == l_inpRecordName) &&
                 (l_srcKeywordName == l_inpKeywordName))
             {
-                std::string l_fruPath(
-                    m_backupAndRestoreCfgJsonObj["destination"]
-                                                ["hardwarePath"]);
-                Parser l_parserObj(l_fruPath, m_sysCfgJsonObj);
-
-                return l_parserObj.updateVpdKeyword(std::make_tuple(
+                l_paramsToWriteOnOtherPath.emplace_back(std::make_tuple(
                     l_dstRecordName, l_dstKeywordName, l_inpKeywordValue));
+                break;
             }
             else if (l_inputPathIsDestinationPath &&
                      (l_dstRecordName == l_inpRecordName) &&
                      (l_dstKeywordName == l_inpKeywordName))
             {
-                std::string l_fruPath(
-                    m_backupAndRestoreCfgJsonObj["source"]["hardwarePath"]);
-                Parser l_parserObj(l_fruPath, m_sysCfgJsonObj);
-
-                return l_parserObj.updateVpdKeyword(std::make_tuple(
+                l_paramsToWriteOnOtherPath.emplace_back(std::make_tuple(
                     l_srcRecordName, l_srcKeywordName, l_inpKeywordValue));
+                break;
             }
         }
     }
 
-    // Received property is not part of backup & restore JSON.
-    return constants::SUCCESS;
+    if (l_paramsToWriteOnOtherPath.empty())
+    {
+        // Received properties are not part of backup & restore JSON.
+        return constants::SUCCESS;
+    }
+
+    try
+    {
+        const std::string l_fruPath(
+            m_backupAndRestoreCfgJsonObj[l_inputPathIsSourcePath
+                                             ? "destination"
+                                             : "source"]["hardwarePath"]);
+        Parser l_parserObj(l_fruPath, m_sysCfgJsonObj);
+
+        types::ListOfWriteVpdParams l_updatedData;
+        return l_parserObj.updateVpdKeywords(l_paramsToWriteOnOtherPath,
+                                             l_updatedData);
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage(
+            "Failed to update keywords on primary or backup path, error : " +
+            std::string(l_ex.what()));
+        return constants::FAILURE;
+    }
 }
 
 } // namespace vpd
@@ -9,6 +9,7 @@
 #include <utility/common_utility.hpp>
 #include <utility/dbus_utility.hpp>
 
+#include <algorithm>
 #include <string>
 
 namespace vpd
@@ -92,649 +93,277 @@ void IbmBiosHandler::biosAttributesCallback(sdbusplus::message_t& i_msg)
     types::BiosBaseTableType l_propMap;
     i_msg.read(l_objPath, l_propMap);
 
-    for (auto l_property : l_propMap)
+    // Looking for change in Base BIOS table only.
+    const auto l_itrToBaseTable = l_propMap.find("BaseBIOSTable");
+    if (l_itrToBaseTable == l_propMap.end())
     {
-        if (l_property.first != "BaseBIOSTable")
-        {
-            // Looking for change in Base BIOS table only.
-            continue;
-        }
-
-        if (auto l_attributeList =
-                std::get_if<std::map<std::string, types::BiosProperty>>(
-                    &(l_property.second)))
-        {
-            for (const auto& l_attribute : *l_attributeList)
-            {
-                if (auto l_val = std::get_if<std::string>(
-                        &(std::get<5>(std::get<1>(l_attribute)))))
-                {
-                    std::string l_attributeName = std::get<0>(l_attribute);
-                    if (l_attributeName == "hb_memory_mirror_mode")
-                    {
-                        saveAmmToVpd(*l_val);
-                    }
-
-                    if (l_attributeName == "pvm_keep_and_clear")
-                    {
-                        saveKeepAndClearToVpd(*l_val);
-                    }
-
-                    if (l_attributeName == "pvm_create_default_lpar")
-                    {
-                        saveCreateDefaultLparToVpd(*l_val);
-                    }
-
-                    if (l_attributeName == "pvm_clear_nvram")
-                    {
-                        saveClearNvramToVpd(*l_val);
-                    }
-
-                    continue;
-                }
-
-                if (auto l_val = std::get_if<int64_t>(
-                        &(std::get<5>(std::get<1>(l_attribute)))))
-                {
-                    std::string l_attributeName = std::get<0>(l_attribute);
-                    if (l_attributeName == "hb_field_core_override")
-                    {
-                        saveFcoToVpd(*l_val);
-                    }
-                }
-            }
-        }
-        else
-        {
-            logging::logMessage("Invalid type received for BIOS table.");
-            EventLogger::createSyncPel(
-                types::ErrorType::FirmwareError, types::SeverityType::Warning,
-                __FILE__, __FUNCTION__, 0,
-                std::string("Invalid type received for BIOS table."),
-                std::nullopt, std::nullopt, std::nullopt, std::nullopt);
-            break;
-        }
-    }
-}
-
-void IbmBiosHandler::backUpOrRestoreBiosAttributes()
-{
-    // process FCO
-    processFieldCoreOverride();
-
-    // process AMM
-    processActiveMemoryMirror();
-
-    // process LPAR
-    processCreateDefaultLpar();
-
-    // process clear NVRAM
-    processClearNvram();
-
-    // process keep and clear
-    processKeepAndClear();
-}
-
-types::BiosAttributeCurrentValue IbmBiosHandler::readBiosAttribute(
-    const std::string& i_attributeName)
-{
-    types::BiosAttributeCurrentValue l_attrValueVariant =
-        dbusUtility::biosGetAttributeMethodCall(i_attributeName);
-
-    return l_attrValueVariant;
-}
-
-void IbmBiosHandler::processFieldCoreOverride()
-{
-    // TODO: Should we avoid doing this at runtime?
-
-    // Read required keyword from Dbus.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdRG);
-
-    if (auto l_fcoInVpd = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
-    {
-        // default length of the keyword is 4 bytes.
-        if (l_fcoInVpd->size() != constants::VALUE_4)
-        {
-            logging::logMessage(
-                "Invalid value read for FCO from D-Bus. Skipping.");
-        }
-
-        //  If FCO in VPD contains anything other that ASCII Space, restore to
-        //  BIOS
-        if (std::any_of(l_fcoInVpd->cbegin(), l_fcoInVpd->cend(),
-                        [](uint8_t l_val) {
-                            return l_val != constants::ASCII_OF_SPACE;
-                        }))
-        {
-            // Restore the data to BIOS.
-            saveFcoToBios(*l_fcoInVpd);
-        }
-        else
-        {
-            types::BiosAttributeCurrentValue l_attrValueVariant =
-                readBiosAttribute("hb_field_core_override");
-
-            if (auto l_fcoInBios = std::get_if<int64_t>(&l_attrValueVariant))
-            {
-                // save the BIOS data to VPD
-                saveFcoToVpd(*l_fcoInBios);
-
-                return;
-            }
-            logging::logMessage("Invalid type recieved for FCO from BIOS.");
-        }
         return;
     }
-    logging::logMessage("Invalid type recieved for FCO from VPD.");
-}
 
-void IbmBiosHandler::saveFcoToVpd(int64_t i_fcoInBios)
-{
-    if (i_fcoInBios < 0)
+    if (const auto l_attributeTable = std::get_if<types::BiosAttributeTable>(
+            &(l_itrToBaseTable->second)))
     {
-        logging::logMessage("Invalid FCO value in BIOS. Skip updating to VPD");
+        syncBiosAttributes(*l_attributeTable, false);
         return;
     }
 
-    // Read required keyword from Dbus.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdRG);
-
-    if (auto l_fcoInVpd = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
-    {
-        // default length of the keyword is 4 bytes.
-        if (l_fcoInVpd->size() != constants::VALUE_4)
-        {
-            logging::logMessage(
-                "Invalid value read for FCO from D-Bus. Skipping.");
-            return;
-        }
-
-        // convert to VPD value type
-        types::BinaryVector l_biosValInVpdFormat = {
-            0, 0, 0, static_cast<uint8_t>(i_fcoInBios)};
-
-        // Update only when the data are different.
-        if (std::memcmp(l_biosValInVpdFormat.data(), l_fcoInVpd->data(),
-                        constants::VALUE_4) != constants::SUCCESS)
-        {
-            if (constants::FAILURE ==
-                m_manager->updateKeyword(
-                    SYSTEM_VPD_FILE_PATH,
-                    types::IpzData(constants::recVSYS, constants::kwdRG,
-                                   l_biosValInVpdFormat)))
-            {
-                logging::logMessage(
-                    "Failed to update " + std::string(constants::kwdRG) +
-                    " keyword to VPD.");
-            }
-        }
-    }
-    else
-    {
-        logging::logMessage("Invalid type read for FCO from DBus.");
-    }
+    logging::logMessage("Invalid type received for BIOS table.");
+    EventLogger::createSyncPel(
+        types::ErrorType::FirmwareError, types::SeverityType::Warning, __FILE__,
+        __FUNCTION__, 0, std::string("Invalid type received for BIOS table."),
+        std::nullopt, std::nullopt, std::nullopt, std::nullopt);
 }
 
-void IbmBiosHandler::saveFcoToBios(const types::BinaryVector& i_fcoVal)
+void IbmBiosHandler::backUpOrRestoreBiosAttributes()
 {
-    if (i_fcoVal.size() != constants::VALUE_4)
-    {
-        logging::logMessage("Bad size for FCO received. Skip writing to BIOS");
-        return;
-    }
-
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
-        "hb_field_core_override",
-        std::make_tuple(
-            "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Integer",
-            i_fcoVal.at(constants::VALUE_3))));
+    const types::BiosAttributeTable l_biosAttributeTable =
+        dbusUtility::getBiosAttributeTable();
 
-    if (!dbusUtility::writeDbusProperty(
-            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
-            constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
+    if (l_biosAttributeTable.empty())
     {
-        // TODO: Should we log informational PEL here as well?
         logging::logMessage(
-            "DBus call to update FCO value in pending attribute failed. ");
-    }
-}
-
-void IbmBiosHandler::saveAmmToVpd(const std::string& i_memoryMirrorMode)
-{
-    if (i_memoryMirrorMode.empty())
-    {
-        logging::logMessage(
-            "Empty memory mirror mode value from BIOS. Skip writing to VPD");
+            "Empty BIOS attribute table. Skip back up or restore of BIOS attributes.");
         return;
     }
 
-    // Read existing value.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdAMM);
-
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
-    {
-        auto l_ammValInVpd = *l_pVal;
-
-        types::BinaryVector l_valToUpdateInVpd{
-            (i_memoryMirrorMode == "Enabled" ? constants::AMM_ENABLED_IN_VPD
-                                             : constants::AMM_DISABLED_IN_VPD)};
-
-        // Check if value is already updated on VPD.
-        if (l_ammValInVpd.at(0) == l_valToUpdateInVpd.at(0))
-        {
-            return;
-        }
-
-        if (constants::FAILURE ==
-            m_manager->updateKeyword(
-                SYSTEM_VPD_FILE_PATH,
-                types::IpzData(constants::recVSYS, constants::kwdAMM,
-                               l_valToUpdateInVpd)))
-        {
-            logging::logMessage(
-                "Failed to update " + std::string(constants::kwdAMM) +
-                " keyword to VPD");
-        }
-    }
-    else
-    {
-        // TODO: Add PEL
-        logging::logMessage(
-            "Invalid type read for memory mirror mode value from DBus. Skip writing to VPD");
-    }
+    syncBiosAttributes(l_biosAttributeTable, true);
 }
 
-void IbmBiosHandler::saveAmmToBios(const uint8_t& i_ammVal)
+const std::vector<IbmBiosHandler::BiosAttributeVpdMap>&
+    IbmBiosHandler::getBiosAttributeVpdMaps()
 {
-    const std::string l_valtoUpdate =
-        (i_ammVal == constants::VALUE_2) ? "Enabled" : "Disabled";
-
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
-        "hb_memory_mirror_mode",
-        std::make_tuple(
-            "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
-            l_valtoUpdate)));
-
-    if (!dbusUtility::writeDbusProperty(
-            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
-            constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
-    {
-        // TODO: Should we log informational PEL here as well?
-        logging::logMessage(
-            "DBus call to update AMM value in pending attribute failed.");
-    }
+    static const std::vector<BiosAttributeVpdMap> l_biosAttributeVpdMaps{
+        {"hb_field_core_override",
+         "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Integer",
+         constants::kwdRG, constants::VALUE_4, 0x00, fcoVpdToBios,
+         fcoBiosToVpd},
+        {"hb_memory_mirror_mode",
+         "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
+         constants::kwdAMM, constants::VALUE_1, 0x00, ammVpdToBios,
+         ammBiosToVpd},
+        // 2nd bit of the keyword is used to store create default LPAR.
+        {"pvm_create_default_lpar",
+         "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
+         constants::kwdClearNVRAM_CreateLPAR, constants::VALUE_1, 0x02,
+         bitVpdToBios, bitBiosToVpd},
+        // 3rd bit of the keyword is used to store clear NVRAM.
+        {"pvm_clear_nvram",
+         "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
+         constants::kwdClearNVRAM_CreateLPAR, constants::VALUE_1, 0x04,
+         bitVpdToBios, bitBiosToVpd},
+        // 1st bit of the keyword is used to store keep and clear.
+        {"pvm_keep_and_clear",
+         "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
+         constants::kwdKeepAndClear, constants::VALUE_1, 0x01, bitVpdToBios,
+         bitBiosToVpd}};
+
+    return l_biosAttributeVpdMaps;
 }
 
-void IbmBiosHandler::processActiveMemoryMirror()
+std::optional<types::BiosAttributePendingValue> IbmBiosHandler::fcoVpdToBios(
+    const types::BinaryVector& i_kwdValue, [[maybe_unused]] uint8_t i_bitMask)
 {
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdAMM);
-
-    if (auto pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    // If FCO in VPD contains anything other that ASCII Space, restore to BIOS.
+    if (std::any_of(i_kwdValue.cbegin(), i_kwdValue.cend(), [](uint8_t l_val) {
+            return l_val != constants::ASCII_OF_SPACE;
+        }))
     {
-        auto l_ammValInVpd = *pVal;
-
-        // Check if active memory mirror value is default in VPD.
-        if (l_ammValInVpd.at(0) == constants::VALUE_0)
-        {
-            types::BiosAttributeCurrentValue l_attrValueVariant =
-                readBiosAttribute("hb_memory_mirror_mode");
-
-            if (auto pVal = std::get_if<std::string>(&l_attrValueVariant))
-            {
-                saveAmmToVpd(*pVal);
-                return;
-            }
-            logging::logMessage(
-                "Invalid type recieved for auto memory mirror mode from BIOS.");
-            return;
-        }
-        else
-        {
-            saveAmmToBios(l_ammValInVpd.at(0));
-        }
-        return;
+        return static_cast<int64_t>(i_kwdValue.at(constants::VALUE_3));
     }
-    logging::logMessage(
-        "Invalid type recieved for auto memory mirror mode from VPD.");
+
+    return std::nullopt;
 }
 
-void IbmBiosHandler::saveCreateDefaultLparToVpd(
-    const std::string& i_createDefaultLparVal)
+bool IbmBiosHandler::fcoBiosToVpd(
+    const types::BiosAttributePendingValue& i_biosValue,
+    [[maybe_unused]] uint8_t i_bitMask, types::BinaryVector& io_kwdValue)
 {
-    if (i_createDefaultLparVal.empty())
+    const auto l_fcoInBios = std::get_if<int64_t>(&i_biosValue);
+    if (l_fcoInBios == nullptr || *l_fcoInBios < 0)
     {
-        logging::logMessage(
-            "Empty value received for Lpar from BIOS. Skip writing in VPD.");
-        return;
+        return false;
     }
 
-    // Read required keyword from DBus as we need to set only a Bit.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdClearNVRAM_CreateLPAR);
-
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
-    {
-        commonUtility::toLower(
-            const_cast<std::string&>(i_createDefaultLparVal));
-
-        // Check for second bit. Bit set for enabled else disabled.
-        if (((((*l_pVal).at(0) & 0x02) == 0x02) &&
-             (i_createDefaultLparVal.compare("enabled") ==
-              constants::STR_CMP_SUCCESS)) ||
-            ((((*l_pVal).at(0) & 0x02) == 0x00) &&
-             (i_createDefaultLparVal.compare("disabled") ==
-              constants::STR_CMP_SUCCESS)))
-        {
-            // Values are same, Don;t update.
-            return;
-        }
-
-        types::BinaryVector l_valToUpdateInVpd;
-        if (i_createDefaultLparVal.compare("enabled") ==
-            constants::STR_CMP_SUCCESS)
-        {
-            // 2nd Bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back((*l_pVal).at(0) | 0x02);
-        }
-        else
-        {
-            // 2nd Bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back((*l_pVal).at(0) & ~(0x02));
-        }
-
-        if (-1 == m_manager->updateKeyword(
-                      SYSTEM_VPD_FILE_PATH,
-                      types::IpzData(constants::vsysInf,
-                                     constants::kwdClearNVRAM_CreateLPAR,
-                                     l_valToUpdateInVpd)))
-        {
-            logging::logMessage(
-                "Failed to update " +
-                std::string(constants::kwdClearNVRAM_CreateLPAR) +
-                " keyword to VPD");
-        }
-
-        return;
-    }
-    logging::logMessage(
-        "Invalid type recieved for create default Lpar from VPD.");
+    // FCO is stored in the last byte of the keyword.
+    io_kwdValue.assign(constants::VALUE_4, 0);
+    io_kwdValue.back() = static_cast<uint8_t>(*l_fcoInBios);
+    return true;
 }
 
-void IbmBiosHandler::saveCreateDefaultLparToBios(
-    const std::string& i_createDefaultLparVal)
+std::optional<types::BiosAttributePendingValue> IbmBiosHandler::ammVpdToBios(
+    const types::BinaryVector& i_kwdValue, [[maybe_unused]] uint8_t i_bitMask)
 {
-    // checking for exact length as it is a string and can have garbage value.
-    if (i_createDefaultLparVal.size() != constants::VALUE_1)
+    // Active memory mirror is default in VPD, BIOS value needs to be saved.
+    if (i_kwdValue.at(0) == constants::VALUE_0)
     {
-        logging::logMessage(
-            "Bad size for Create default LPAR in VPD. Skip writing to BIOS.");
-        return;
+        return std::nullopt;
     }
 
-    std::string l_valtoUpdate =
-        (i_createDefaultLparVal.at(0) & 0x02) ? "Enabled" : "Disabled";
-
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
-        "pvm_create_default_lpar",
-        std::make_tuple(
-            "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
-            l_valtoUpdate)));
+    return std::string(
+        (i_kwdValue.at(0) == constants::AMM_ENABLED_IN_VPD) ? "Enabled"
+                                                            : "Disabled");
+}
 
-    if (!dbusUtility::writeDbusProperty(
-            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
-            constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
+bool IbmBiosHandler::ammBiosToVpd(
+    const types::BiosAttributePendingValue& i_biosValue,
+    [[maybe_unused]] uint8_t i_bitMask, types::BinaryVector& io_kwdValue)
+{
+    const auto l_ammInBios = std::get_if<std::string>(&i_biosValue);
+    if (l_ammInBios == nullptr || l_ammInBios->empty())
     {
-        logging::logMessage(
-            "DBus call to update lpar value in pending attribute failed.");
+        return false;
     }
 
-    return;
+    io_kwdValue.at(0) =
+        (*l_ammInBios == "Enabled") ? constants::AMM_ENABLED_IN_VPD
+                                    : constants::AMM_DISABLED_IN_VPD;
+    return true;
 }
 
-void IbmBiosHandler::processCreateDefaultLpar()
+std::optional<types::BiosAttributePendingValue> IbmBiosHandler::bitVpdToBios(
+    const types::BinaryVector& i_kwdValue, uint8_t i_bitMask)
 {
-    // Read required keyword from DBus.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdClearNVRAM_CreateLPAR);
-
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
-    {
-        saveCreateDefaultLparToBios(std::to_string(l_pVal->at(0)));
-        return;
-    }
-    logging::logMessage(
-        "Invalid type recieved for create default Lpar from VPD.");
+    return std::string((i_kwdValue.at(0) & i_bitMask) ? "Enabled" : "Disabled");
 }
 
-void IbmBiosHandler::saveClearNvramToVpd(const std::string& i_clearNvramVal)
+bool IbmBiosHandler::bitBiosToVpd(
+    const types::BiosAttributePendingValue& i_biosValue, uint8_t i_bitMask,
+    types::BinaryVector& io_kwdValue)
 {
-    if (i_clearNvramVal.empty())
+    const auto l_valInBios = std::get_if<std::string>(&i_biosValue);
+    if (l_valInBios == nullptr || l_valInBios->empty())
     {
-        logging::logMessage(
-            "Empty value received for clear NVRAM from BIOS. Skip updating to VPD.");
-        return;
+        return false;
     }
 
-    // Read required keyword from DBus as we need to set only a Bit.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdClearNVRAM_CreateLPAR);
+    std::string l_value{*l_valInBios};
+    commonUtility::toLower(l_value);
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    // Bit set for enabled else disabled.
+    if (l_value.compare("enabled") == constants::STR_CMP_SUCCESS)
     {
-        commonUtility::toLower(const_cast<std::string&>(i_clearNvramVal));
-
-        // Check for third bit. Bit set for enabled else disabled.
-        if (((((*l_pVal).at(0) & 0x04) == 0x04) &&
-             (i_clearNvramVal.compare("enabled") ==
-              constants::STR_CMP_SUCCESS)) ||
-            ((((*l_pVal).at(0) & 0x04) == 0x00) &&
-             (i_clearNvramVal.compare("disabled") ==
-              constants::STR_CMP_SUCCESS)))
-        {
-            // Don't update, values are same.
-            return;
-        }
-
-        types::BinaryVector l_valToUpdateInVpd;
-        if (i_clearNvramVal.compare("enabled") == constants::STR_CMP_SUCCESS)
-        {
-            // 3rd bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back(
-                (*l_pVal).at(0) | constants::VALUE_4);
-        }
-        else
-        {
-            // 3rd bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back(
-                (*l_pVal).at(0) & ~(constants::VALUE_4));
-        }
-
-        if (-1 == m_manager->updateKeyword(
-                      SYSTEM_VPD_FILE_PATH,
-                      types::IpzData(constants::vsysInf,
-                                     constants::kwdClearNVRAM_CreateLPAR,
-                                     l_valToUpdateInVpd)))
-        {
-            logging::logMessage(
-                "Failed to update " +
-                std::string(constants::kwdClearNVRAM_CreateLPAR) +
-                " keyword to VPD");
-        }
-
-        return;
+        io_kwdValue.at(0) |= i_bitMask;
     }
-    logging::logMessage("Invalid type recieved for clear NVRAM from VPD.");
-}
-
-void IbmBiosHandler::saveClearNvramToBios(const std::string& i_clearNvramVal)
-{
-    // Check for the exact length as it is a string and it can have a garbage
-    // value.
-    if (i_clearNvramVal.size() != constants::VALUE_1)
-    {
-        logging::logMessage(
-            "Bad size for clear NVRAM in VPD. Skip writing to BIOS.");
-        return;
-    }
-
-    // 3rd bit is used to store clear NVRAM value.
-    std::string l_valtoUpdate =
-        (i_clearNvramVal.at(0) & constants::VALUE_4) ? "Enabled" : "Disabled";
-
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
-        "pvm_clear_nvram",
-        std::make_tuple(
-            "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
-            l_valtoUpdate)));
-
-    if (!dbusUtility::writeDbusProperty(
-            constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
-            constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
+    else
     {
-        logging::logMessage(
-            "DBus call to update NVRAM value in pending attribute failed.");
+        io_kwdValue.at(0) &= static_cast<uint8_t>(~i_bitMask);
     }
+    return true;
 }
 
-void IbmBiosHandler::processClearNvram()
+void IbmBiosHandler::syncBiosAttributes(
+    const types::BiosAttributeTable& i_biosAttributeTable,
+    bool i_isRestoreRequired)
 {
-    // Read required keyword from VPD.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
+    // Read all the keywords backing BIOS attributes in one call.
+    const types::PropertyMap l_vsysKwdMap = dbusUtility::getPropertyMap(
         constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdClearNVRAM_CreateLPAR);
+        constants::vsysInf);
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
-    {
-        saveClearNvramToBios(std::to_string(l_pVal->at(0)));
-        return;
-    }
-    logging::logMessage("Invalid type recieved for clear NVRAM from VPD.");
-}
-
-void IbmBiosHandler::saveKeepAndClearToVpd(const std::string& i_KeepAndClearVal)
-{
-    if (i_KeepAndClearVal.empty())
+    if (l_vsysKwdMap.empty())
     {
         logging::logMessage(
-            "Empty value received for keep and clear from BIOS. Skip updating to VPD.");
+            "Failed to read VSYS keywords from DBus. Skip BIOS attributes sync.");
         return;
     }
 
-    // Read required keyword from DBus as we need to set only a Bit.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdKeepAndClear);
+    // Keyword values as read from VPD and with BIOS values applied on them.
+    std::map<std::string, types::BinaryVector> l_kwdValuesInVpd;
+    std::map<std::string, types::BinaryVector> l_kwdValuesToUpdate;
+
+    types::PendingBIOSAttrs l_pendingBiosAttributes;
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    for (const auto& l_map : getBiosAttributeVpdMaps())
     {
-        commonUtility::toLower(const_cast<std::string&>(i_KeepAndClearVal));
-
-        // Check for first bit. Bit set for enabled else disabled.
-        if (((((*l_pVal).at(0) & 0x01) == 0x01) &&
-             (i_KeepAndClearVal.compare("enabled") ==
-              constants::STR_CMP_SUCCESS)) ||
-            ((((*l_pVal).at(0) & 0x01) == 0x00) &&
-             (i_KeepAndClearVal.compare("disabled") ==
-              constants::STR_CMP_SUCCESS)))
+        const auto l_itrToAttribute =
+            i_biosAttributeTable.find(l_map.m_attributeName);
+        if (l_itrToAttribute == i_biosAttributeTable.end())
         {
-            // Don't update, values are same.
-            return;
+            // Attribute not in the table, not part of BIOS change.
+            continue;
         }
 
-        types::BinaryVector l_valToUpdateInVpd;
-        if (i_KeepAndClearVal.compare("enabled") == constants::STR_CMP_SUCCESS)
+        if (!l_kwdValuesToUpdate.contains(l_map.m_keyword))
         {
-            // 1st bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back(
-                (*l_pVal).at(0) | constants::VALUE_1);
+            const auto l_itrToKwd = l_vsysKwdMap.find(l_map.m_keyword);
+            const auto l_kwdValue =
+                (l_itrToKwd != l_vsysKwdMap.end())
+                    ? std::get_if<types::BinaryVector>(&(l_itrToKwd->second))
+                    : nullptr;
+
+            if (l_kwdValue == nullptr ||
+                l_kwdValue->size() < l_map.m_keywordSize)
+            {
+                logging::logMessage(
+                    "Invalid value read for keyword " +
+                    std::string(l_map.m_keyword) + " from DBus. Skip syncing " +
+                    std::string(l_map.m_attributeName));
+                continue;
+            }
+
+            l_kwdValuesInVpd.emplace(l_map.m_keyword, *l_kwdValue);
+            l_kwdValuesToUpdate.emplace(l_map.m_keyword, *l_kwdValue);
         }
-        else
+
+        const types::BiosAttributePendingValue& l_valueInBios =
+            std::get<5>(l_itrToAttribute->second);
+
+        if (i_isRestoreRequired)
         {
-            // 1st bit is used to store the value.
-            l_valToUpdateInVpd.emplace_back(
-                (*l_pVal).at(0) & ~(constants::VALUE_1));
+            const auto l_valueInVpd = l_map.m_vpdToBios(
+                l_kwdValuesInVpd.at(l_map.m_keyword), l_map.m_bitMask);
+
+            if (l_valueInVpd.has_value())
+            {
+                // Restore the data to BIOS, only if it differs.
+                if (*l_valueInVpd != l_valueInBios)
+                {
+                    l_pendingBiosAttributes.emplace_back(
+                        l_map.m_attributeName,
+                        std::make_tuple(l_map.m_attributeType, *l_valueInVpd));
+                }
+                continue;
+            }
         }
 
-        if (-1 ==
-            m_manager->updateKeyword(
-                SYSTEM_VPD_FILE_PATH,
-                types::IpzData(constants::vsysInf, constants::kwdKeepAndClear,
-                               l_valToUpdateInVpd)))
+        // Save the BIOS data to VPD.
+        if (!l_map.m_biosToVpd(l_valueInBios, l_map.m_bitMask,
+                               l_kwdValuesToUpdate.at(l_map.m_keyword)))
         {
-            logging::logMessage(
-                "Failed to update " + std::string(constants::kwdKeepAndClear) +
-                " keyword to VPD");
+            logging::logMessage("Invalid value in BIOS for " +
+                                std::string(l_map.m_attributeName) +
+                                ". Skip updating to VPD.");
         }
-
-        return;
-    }
-    logging::logMessage("Invalid type recieved for keep and clear from VPD.");
-}
-
-void IbmBiosHandler::saveKeepAndClearToBios(
-    const std::string& i_KeepAndClearVal)
-{
-    // checking for exact length as it is a string and can have garbage value.
-    if (i_KeepAndClearVal.size() != constants::VALUE_1)
-    {
-        logging::logMessage(
-            "Bad size for keep and clear in VPD. Skip writing to BIOS.");
-        return;
     }
 
-    // 1st bit is used to store keep and clear value.
-    std::string l_valtoUpdate =
-        (i_KeepAndClearVal.at(0) & constants::VALUE_1) ? "Enabled" : "Disabled";
-
-    types::PendingBIOSAttrs l_pendingBiosAttribute;
-    l_pendingBiosAttribute.push_back(std::make_pair(
-        "pvm_keep_and_clear",
-        std::make_tuple(
-            "xyz.openbmc_project.BIOSConfig.Manager.AttributeType.Enumeration",
-            l_valtoUpdate)));
-
-    if (!dbusUtility::writeDbusProperty(
+    if (!l_pendingBiosAttributes.empty() &&
+        !dbusUtility::writeDbusProperty(
             constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
             constants::biosConfigMgrInterface, "PendingAttributes",
-            l_pendingBiosAttribute))
+            l_pendingBiosAttributes))
     {
+        // TODO: Should we log informational PEL here as well?
         logging::logMessage(
-            "DBus call to update keep and clear value in pending attribute failed.");
+            "DBus call to update BIOS attributes in pending attribute failed.");
     }
-}
 
-void IbmBiosHandler::processKeepAndClear()
-{
-    // Read required keyword from VPD.
-    auto l_kwdValueVariant = dbusUtility::readDbusProperty(
-        constants::pimServiceName, constants::systemVpdInvPath,
-        constants::vsysInf, constants::kwdKeepAndClear);
+    types::ListOfWriteVpdParams l_paramsToWriteData;
+    for (const auto& [l_keyword, l_kwdValue] : l_kwdValuesToUpdate)
+    {
+        // Update only when the data are different.
+        if (l_kwdValue != l_kwdValuesInVpd.at(l_keyword))
+        {
+            l_paramsToWriteData.emplace_back(
+                types::IpzData(constants::recVSYS, l_keyword, l_kwdValue));
+        }
+    }
 
-    if (auto l_pVal = std::get_if<types::BinaryVector>(&l_kwdValueVariant))
+    if (!l_paramsToWriteData.empty() &&
+        constants::FAILURE ==
+            m_manager->updateKeywords(SYSTEM_VPD_FILE_PATH,
+                                      l_paramsToWriteData))
     {
-        saveKeepAndClearToBios(std::to_string(l_pVal->at(0)));
-        return;
+        logging::logMessage("Failed to update BIOS attributes to VPD.");
     }
-    logging::logMessage("Invalid type recieved for keep and clear from VPD.");
 }
 } // namespace vpd
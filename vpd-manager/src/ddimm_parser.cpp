@@ -2,6 +2,7 @@
 
 #include "constants.hpp"
 #include "exceptions.hpp"
+#include "metrics.hpp"
 
 #include <cmath>
 #include <cstdint>
@@ -383,6 +384,8 @@ void DdimmVpdParser::readKeywords(
 
 types::VPDMapVariant DdimmVpdParser::parse()
 {
+    const ScopedLatency l_latency(Histogram::DdimmParseLatency);
+
     try
     {
         // Read the data and return the map
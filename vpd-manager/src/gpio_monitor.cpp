@@ -47,7 +47,7 @@ void GpioEventHandler::handleChangeInGpioPin(const bool& i_isFruPresent)
         {
             uint16_t l_errCode = 0;
             std::string l_invPath = jsonUtility::getInventoryObjPathFromJson(
-                m_worker->getSysCfgJsonObj(), m_fruPath, l_errCode);
+                *m_worker->getSysCfgJsonObj(), m_fruPath, l_errCode);
 
             if (l_errCode)
             {
@@ -84,7 +84,7 @@ void GpioEventHandler::handleTimerExpiry(
 
     uint16_t l_errCode = 0;
     bool l_currentPresencePinValue = jsonUtility::processGpioPresenceTag(
-        m_worker->getSysCfgJsonObj(), m_fruPath, "pollingRequired",
+        *m_worker->getSysCfgJsonObj(), m_fruPath, "pollingRequired",
         "hotPlugging", l_errCode);
 
     if (l_errCode && l_errCode != error_code::DEVICE_NOT_PRESENT)
@@ -112,7 +112,7 @@ void GpioEventHandler::setEventHandlerForGpioPresence(
 {
     uint16_t l_errCode = 0;
     m_prevPresencePinValue = jsonUtility::processGpioPresenceTag(
-        m_worker->getSysCfgJsonObj(), m_fruPath, "pollingRequired",
+        *m_worker->getSysCfgJsonObj(), m_fruPath, "pollingRequired",
         "hotPlugging", l_errCode);
 
     if (l_errCode && l_errCode != error_code::DEVICE_NOT_PRESENT)
@@ -146,7 +146,7 @@ void GpioMonitor::initHandlerForGpio(
 
     uint16_t l_errCode = 0;
     std::vector<std::string> l_gpioPollingRequiredFrusList =
-        jsonUtility::getListOfGpioPollingFrus(m_sysCfgJsonObj, l_errCode);
+        jsonUtility::getListOfGpioPollingFrus(*m_sysCfgJsonObj, l_errCode);
 
     if (l_errCode)
     {
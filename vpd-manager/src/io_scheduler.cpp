@@ -0,0 +1,289 @@
+#include "io_scheduler.hpp"
+
+#include "logger.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+
+namespace vpd
+{
+IoScheduler::IoSlot::IoSlot(IoScheduler& i_scheduler,
+                            const std::string& i_busId) :
+    m_scheduler(i_scheduler), m_busId(i_busId)
+{
+    std::unique_lock l_lock(m_scheduler.m_mutex);
+    m_scheduler.m_slotReleased.wait(l_lock, [this]() {
+        return m_scheduler.m_abandonedIoPerBus.contains(m_busId) ||
+               (m_scheduler.m_activeIoPerBus[m_busId] <
+                m_scheduler.m_maxIoPerBus);
+    });
+
+    if (m_scheduler.m_abandonedIoPerBus.contains(m_busId))
+    {
+        throw std::runtime_error("No I/O slot on bus " + m_busId +
+                                 ", an abandoned I/O is still in progress.");
+    }
+
+    ++m_scheduler.m_activeIoPerBus[m_busId];
+}
+
+IoScheduler::IoSlot::~IoSlot()
+{
+    {
+        std::scoped_lock l_lock(m_scheduler.m_mutex);
+        --m_scheduler.m_activeIoPerBus[m_busId];
+
+        if (m_isAbandoned)
+        {
+            if (--m_scheduler.m_abandonedIoPerBus[m_busId] == 0)
+            {
+                m_scheduler.m_abandonedIoPerBus.erase(m_busId);
+            }
+            --m_scheduler.m_abandonedIoCount;
+        }
+    }
+
+    m_scheduler.m_slotReleased.notify_all();
+}
+
+void IoScheduler::IoSlot::abandon() noexcept
+{
+    {
+        std::scoped_lock l_lock(m_scheduler.m_mutex);
+        if (m_isAbandoned)
+        {
+            return;
+        }
+
+        m_isAbandoned = true;
+        ++m_scheduler.m_abandonedIoPerBus[m_busId];
+        ++m_scheduler.m_abandonedIoCount;
+    }
+
+    // Waiters on the bus are failed, instead of waiting for the I/O.
+    m_scheduler.m_slotReleased.notify_all();
+}
+
+IoScheduler::IoScheduler(const nlohmann::json& i_sysCfgJsonObj,
+                         size_t i_maxIoPerBus) :
+    m_maxIoPerBus(std::max<size_t>(i_maxIoPerBus, 1))
+{
+    mapMuxChannels(i_sysCfgJsonObj);
+}
+
+void IoScheduler::mapMuxChannels(const nlohmann::json& i_sysCfgJsonObj) noexcept
+{
+    if (!i_sysCfgJsonObj.contains("muxes"))
+    {
+        return;
+    }
+
+    try
+    {
+        for (const auto& l_mux : i_sysCfgJsonObj["muxes"])
+        {
+            const std::string l_muxBus = l_mux.value("i2bus", "");
+
+            if (l_muxBus.empty())
+            {
+                continue;
+            }
+
+            // Mux device directory holds a channel-N link to bus of each of
+            // its channel.
+            std::filesystem::path l_muxDevicePath;
+
+            if (l_mux.contains("holdidlepath"))
+            {
+                l_muxDevicePath = std::filesystem::path(
+                                      l_mux["holdidlepath"].get<std::string>())
+                                      .parent_path();
+            }
+            else if (l_mux.contains("deviceaddress"))
+            {
+                // Address in JSON is in 8 bit format, sysfs uses 7 bit format.
+                const auto l_address = std::stoul(
+                    l_mux["deviceaddress"].get<std::string>(), nullptr, 16);
+
+                std::ostringstream l_muxDevice;
+                l_muxDevice << "/sys/bus/i2c/devices/" << l_muxBus << "-"
+                            << std::hex << std::setw(4) << std::setfill('0')
+                            << (l_address >> 1);
+                l_muxDevicePath = l_muxDevice.str();
+            }
+
+            std::error_code l_ec;
+            for (const auto& l_entry :
+                 std::filesystem::directory_iterator(l_muxDevicePath, l_ec))
+            {
+                if (!l_entry.path().filename().string().starts_with(
+                        "channel-"))
+                {
+                    continue;
+                }
+
+                // Link points to i2c-<channel's bus number>
+                const std::string l_channelBus =
+                    std::filesystem::read_symlink(l_entry.path(), l_ec)
+                        .filename()
+                        .string();
+
+                if (!l_ec && l_channelBus.starts_with("i2c-"))
+                {
+                    m_muxChannelToBus.emplace(l_channelBus.substr(4), l_muxBus);
+                }
+            }
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Failed to map mux channels to bus, error : " +
+                            std::string(l_ex.what()));
+    }
+}
+
+std::string IoScheduler::getRootI2cBus(
+    const std::string& i_busNumber) const noexcept
+{
+    try
+    {
+        std::string l_busNumber = i_busNumber;
+
+        // Walk up mux channels, a mux can sit behind another mux's channel.
+        for (size_t l_depth = 0; l_depth < constants::MAX_MUX_DEPTH; ++l_depth)
+        {
+            if (auto l_itr = m_muxChannelToBus.find(l_busNumber);
+                l_itr != m_muxChannelToBus.end())
+            {
+                l_busNumber = l_itr->second;
+                continue;
+            }
+
+            // Mux not listed in JSON, kernel links a channel's bus to the mux
+            // device as mux_device.
+            std::error_code l_ec;
+            const std::string l_muxDevice =
+                std::filesystem::read_symlink(
+                    "/sys/bus/i2c/devices/i2c-" + l_busNumber + "/mux_device",
+                    l_ec)
+                    .filename()
+                    .string();
+
+            if (l_ec || l_muxDevice.find('-') == std::string::npos)
+            {
+                break;
+            }
+
+            // Mux device is named <bus>-<address>
+            l_busNumber = l_muxDevice.substr(0, l_muxDevice.find('-'));
+        }
+
+        return l_busNumber;
+    }
+    catch (const std::exception& l_ex)
+    {
+        return i_busNumber;
+    }
+}
+
+std::string IoScheduler::getBusId(
+    const std::string& i_eepromPath) const noexcept
+{
+    try
+    {
+        // I2C device directory is named <bus>-<address>, eg:
+        // /sys/bus/i2c/drivers/at24/8-0050/eeprom
+        static const std::regex l_i2cDevice(R"(/(\d+)-[0-9a-fA-F]{4}/)");
+
+        // SPI device directory is named spi<bus>.<chip select>, eg:
+        // /sys/bus/spi/drivers/at25/spi12.0/eeprom
+        static const std::regex l_spiDevice(R"(/spi/.*/spi(\d+)\.\d+/)");
+
+        std::smatch l_match;
+        if (std::regex_search(i_eepromPath, l_match, l_i2cDevice))
+        {
+            return "i2c-" + getRootI2cBus(l_match[1].str());
+        }
+
+        if (std::regex_search(i_eepromPath, l_match, l_spiDevice))
+        {
+            return "spi-" + l_match[1].str();
+        }
+
+        return std::filesystem::path(i_eepromPath).parent_path().string();
+    }
+    catch (const std::exception& l_ex)
+    {
+        return i_eepromPath;
+    }
+}
+
+std::vector<std::string> IoScheduler::getScheduledOrder(
+    const std::vector<std::string>& i_eepromPaths) const noexcept
+{
+    try
+    {
+        // Group EEPROMs by bus, keeping the order in which buses are seen.
+        std::vector<std::vector<std::string>> l_eepromsPerBus;
+        std::unordered_map<std::string, size_t> l_busIndex;
+
+        for (const auto& l_eepromPath : i_eepromPaths)
+        {
+            const auto [l_itr, l_isNewBus] = l_busIndex.try_emplace(
+                getBusId(l_eepromPath), l_eepromsPerBus.size());
+
+            if (l_isNewBus)
+            {
+                l_eepromsPerBus.emplace_back();
+            }
+
+            l_eepromsPerBus[l_itr->second].push_back(l_eepromPath);
+        }
+
+        // Busiest bus takes the longest, start it first.
+        std::ranges::stable_sort(
+            l_eepromsPerBus, [](const auto& i_lhs, const auto& i_rhs) {
+                return i_lhs.size() > i_rhs.size();
+            });
+
+        std::vector<std::string> l_scheduledOrder;
+        l_scheduledOrder.reserve(i_eepromPaths.size());
+
+        for (size_t l_round = 0;
+             l_scheduledOrder.size() < i_eepromPaths.size(); ++l_round)
+        {
+            for (const auto& l_eeproms : l_eepromsPerBus)
+            {
+                if (l_round < l_eeproms.size())
+                {
+                    l_scheduledOrder.push_back(l_eeproms[l_round]);
+                }
+            }
+        }
+
+        return l_scheduledOrder;
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Failed to schedule EEPROMs, error : " +
+                            std::string(l_ex.what()));
+        return i_eepromPaths;
+    }
+}
+
+std::unique_ptr<IoScheduler::IoSlot> IoScheduler::acquireIoSlot(
+    const std::string& i_eepromPath)
+{
+    return std::make_unique<IoSlot>(*this, getBusId(i_eepromPath));
+}
+
+size_t IoScheduler::getAbandonedIoCount() noexcept
+{
+    std::scoped_lock l_lock(m_mutex);
+    return m_abandonedIoCount;
+}
+} // namespace vpd
@@ -6,12 +6,16 @@
 
 #include "constants.hpp"
 #include "exceptions.hpp"
+#include "metrics.hpp"
+#include "tracer.hpp"
 #include "utility/event_logger_utility.hpp"
 #include "utility/vpd_specific_utility.hpp"
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <typeindex>
+#include <utility>
 
 namespace vpd
 {
@@ -73,6 +77,7 @@ bool IpzVpdParser::vhdrEccCheck()
         Length::VHDR_ECC_LENGTH);
     if (l_status == VPD_ECC_CORRECTABLE_DATA)
     {
+        Metrics::getMetricsInstance().increment(Counter::EccCorrections);
         EventLogger::createSyncPel(
             types::ErrorType::EccCheckFailed,
             types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
@@ -81,6 +86,7 @@ bool IpzVpdParser::vhdrEccCheck()
     }
     else if (l_status != VPD_ECC_OK)
     {
+        Metrics::getMetricsInstance().increment(Counter::EccFailures);
         return false;
     }
 
@@ -119,6 +125,7 @@ bool IpzVpdParser::vtocEccCheck()
         const_cast<uint8_t*>(&vpdPtr[vtocECCOffset]), vtocECCLength);
     if (l_status == VPD_ECC_CORRECTABLE_DATA)
     {
+        Metrics::getMetricsInstance().increment(Counter::EccCorrections);
         EventLogger::createSyncPel(
             types::ErrorType::EccCheckFailed,
             types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
@@ -127,6 +134,7 @@ bool IpzVpdParser::vtocEccCheck()
     }
     else if (l_status != VPD_ECC_OK)
     {
+        Metrics::getMetricsInstance().increment(Counter::EccFailures);
         return false;
     }
 
@@ -166,6 +174,7 @@ bool IpzVpdParser::recordEccCheck(types::BinaryVector::const_iterator iterator)
 
     if (l_status == VPD_ECC_CORRECTABLE_DATA)
     {
+        Metrics::getMetricsInstance().increment(Counter::EccCorrections);
         EventLogger::createSyncPel(
             types::ErrorType::EccCheckFailed,
             types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
@@ -174,6 +183,7 @@ bool IpzVpdParser::recordEccCheck(types::BinaryVector::const_iterator iterator)
     }
     else if (l_status != VPD_ECC_OK)
     {
+        Metrics::getMetricsInstance().increment(Counter::EccFailures);
         return false;
     }
 
@@ -374,19 +384,28 @@ void IpzVpdParser::processRecord(auto recordOffset)
 
 types::VPDMapVariant IpzVpdParser::parse()
 {
+    const ScopedLatency l_latency(Histogram::IpzParseLatency);
+
     try
     {
         auto itrToVPD = m_vpdVector.cbegin();
 
-        // Check vaidity of VHDR record
-        checkHeader(itrToVPD);
+        std::pair<types::RecordOffsetList, types::InvalidRecordList> l_result;
+        {
+            // Covers header and VTOC checks, including their ECC checks, and
+            // lookup of record offsets.
+            const TraceSpan l_span("VtocParse", m_vpdFilePath);
+
+            // Check vaidity of VHDR record
+            checkHeader(itrToVPD);
 
-        // Read the table of contents
-        auto ptLen = readTOC(itrToVPD);
+            // Read the table of contents
+            auto ptLen = readTOC(itrToVPD);
 
-        // Read the table of contents record, to get offsets
-        // to other records.
-        auto l_result = readPT(itrToVPD, ptLen);
+            // Read the table of contents record, to get offsets
+            // to other records.
+            l_result = readPT(itrToVPD, ptLen);
+        }
         auto recordOffsets = l_result.first;
         for (const auto& offset : recordOffsets)
         {
@@ -408,10 +427,18 @@ types::VPDMapVariant IpzVpdParser::parse()
     }
 }
 
-types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
-    const types::Record& i_recordName, const types::Keyword& i_keywordName,
+const types::KeywordIndex& IpzVpdParser::getKeywordIndex(
+    const types::Record& i_recordName,
     const types::RecordOffset& i_recordDataOffset)
 {
+    if (auto l_itr = m_keywordIndex.find(i_recordName);
+        l_itr != m_keywordIndex.end())
+    {
+        Metrics::getMetricsInstance().increment(Counter::KeywordIndexHits);
+        return l_itr->second;
+    }
+    Metrics::getMetricsInstance().increment(Counter::KeywordIndexMisses);
+
     auto l_iterator = m_vpdVector.cbegin();
 
     // Go to the record name in the given record's offset
@@ -420,17 +447,21 @@ types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
                          m_vpdVector.cend());
 
     // Check if the record is present in the given record's offset
-    if (i_recordName !=
-        std::string(l_iterator,
-                    std::ranges::next(l_iterator, Length::RECORD_NAME,
-                                      m_vpdVector.cend())))
+    const std::string l_recordFound(
+        l_iterator,
+        std::ranges::next(l_iterator, Length::RECORD_NAME, m_vpdVector.cend()));
+
+    if (i_recordName != l_recordFound)
     {
-        throw std::runtime_error(
-            "Given record is not present in the offset provided");
+        throw(DataException("Given record found at the offset " +
+                            std::to_string(i_recordDataOffset) + " is : " +
+                            l_recordFound + " and not " + i_recordName));
     }
 
     std::ranges::advance(l_iterator, Length::RECORD_NAME, m_vpdVector.cend());
 
+    types::KeywordIndex l_keywordIndex;
+
     std::string l_kwName = std::string(
         l_iterator,
         std::ranges::next(l_iterator, Length::KW_NAME, m_vpdVector.cend()));
@@ -438,13 +469,19 @@ types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
     // Iterate through the keywords until the last keyword PF is found.
     while (l_kwName != constants::LAST_KW)
     {
+        if (l_iterator == m_vpdVector.cend())
+        {
+            throw(DataException("Keyword PF not found in record " +
+                                i_recordName));
+        }
+
         // First character required for #D keyword check
         char l_kwNameStart = *l_iterator;
 
         std::ranges::advance(l_iterator, Length::KW_NAME, m_vpdVector.cend());
 
         // Get the keyword's data length
-        auto l_kwdDataLength = 0;
+        size_t l_kwdDataLength = 0;
 
         if (constants::POUND_KW == l_kwNameStart)
         {
@@ -459,13 +496,13 @@ types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
                                  m_vpdVector.cend());
         }
 
-        if (l_kwName == i_keywordName)
-        {
-            // Return keyword's value to the caller
-            return types::BinaryVector(
-                l_iterator, std::ranges::next(l_iterator, l_kwdDataLength,
-                                              m_vpdVector.cend()));
-        }
+        const size_t l_kwdDataOffset =
+            std::distance(m_vpdVector.cbegin(), l_iterator);
+
+        // Keep the first occurrence, in case a keyword is repeated.
+        l_keywordIndex.try_emplace(
+            l_kwName, l_kwdDataOffset,
+            std::min(l_kwdDataLength, m_vpdVector.size() - l_kwdDataOffset));
 
         // next keyword search
         std::ranges::advance(l_iterator, l_kwdDataLength, m_vpdVector.cend());
@@ -476,56 +513,82 @@ types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
             std::ranges::next(l_iterator, Length::KW_NAME, m_vpdVector.cend()));
     }
 
-    // Keyword not found
-    throw std::runtime_error("Given keyword not found.");
+    return m_keywordIndex.emplace(i_recordName, std::move(l_keywordIndex))
+        .first->second;
 }
 
-types::RecordData IpzVpdParser::getRecordDetailsFromVTOC(
-    const types::Record& i_recordName, const types::RecordOffset& i_vtocOffset)
+types::BinaryVector IpzVpdParser::getKeywordValueFromRecord(
+    const types::Record& i_recordName, const types::Keyword& i_keywordName,
+    const types::RecordOffset& i_recordDataOffset)
 {
-    // Get VTOC's PT keyword value.
-    const auto l_vtocPTKwValue =
-        getKeywordValueFromRecord("VTOC", "PT", i_vtocOffset);
+    const auto& l_keywordIndex =
+        getKeywordIndex(i_recordName, i_recordDataOffset);
 
-    // Parse through VTOC PT keyword value to find the record which we are
-    // interested in.
-    auto l_vtocPTItr = l_vtocPTKwValue.cbegin();
+    auto l_kwItr = l_keywordIndex.find(i_keywordName);
+    if (l_kwItr == l_keywordIndex.end())
+    {
+        // Keyword not found
+        throw std::runtime_error("Given keyword not found.");
+    }
 
-    types::RecordData l_recordData;
+    const auto& [l_kwdDataOffset, l_kwdDataLength] = l_kwItr->second;
+    const auto l_kwdDataBegin =
+        std::next(m_vpdVector.cbegin(), l_kwdDataOffset);
+
+    // Return keyword's value to the caller
+    return types::BinaryVector(l_kwdDataBegin,
+                               std::next(l_kwdDataBegin, l_kwdDataLength));
+}
 
-    while (l_vtocPTItr < l_vtocPTKwValue.cend())
+types::RecordData IpzVpdParser::getRecordDetailsFromVTOC(
+    const types::Record& i_recordName, const types::RecordOffset& i_vtocOffset)
+{
+    if (m_recordIndex.empty())
     {
-        if (i_recordName ==
-            std::string(l_vtocPTItr, l_vtocPTItr + Length::RECORD_NAME))
+        // Get VTOC's PT keyword value.
+        const auto l_vtocPTKwValue =
+            getKeywordValueFromRecord("VTOC", "PT", i_vtocOffset);
+
+        // Parse through VTOC PT keyword value once, to index details of all
+        // the records.
+        auto l_vtocPTItr = l_vtocPTKwValue.cbegin();
+
+        while (std::distance(l_vtocPTItr, l_vtocPTKwValue.cend()) >=
+               Length::SKIP_A_RECORD_IN_PT)
         {
-            // Record found in VTOC PT keyword. Get offset
-            std::ranges::advance(l_vtocPTItr,
-                                 Length::RECORD_NAME + Length::RECORD_TYPE,
-                                 l_vtocPTKwValue.cend());
-            const auto l_recordOffset = readUInt16LE(l_vtocPTItr);
+            const std::string l_recordName(l_vtocPTItr,
+                                           l_vtocPTItr + Length::RECORD_NAME);
 
-            std::ranges::advance(l_vtocPTItr, Length::RECORD_OFFSET,
-                                 l_vtocPTKwValue.cend());
-            const auto l_recordLength = readUInt16LE(l_vtocPTItr);
+            auto l_recordDetailsItr = std::next(
+                l_vtocPTItr, Length::RECORD_NAME + Length::RECORD_TYPE);
+            const auto l_recordOffset = readUInt16LE(l_recordDetailsItr);
 
-            std::ranges::advance(l_vtocPTItr, Length::RECORD_LENGTH,
-                                 l_vtocPTKwValue.cend());
-            const auto l_eccOffset = readUInt16LE(l_vtocPTItr);
+            std::ranges::advance(l_recordDetailsItr, Length::RECORD_OFFSET);
+            const auto l_recordLength = readUInt16LE(l_recordDetailsItr);
 
-            std::ranges::advance(l_vtocPTItr, Length::RECORD_ECC_OFFSET,
-                                 l_vtocPTKwValue.cend());
-            const auto l_eccLength = readUInt16LE(l_vtocPTItr);
+            std::ranges::advance(l_recordDetailsItr, Length::RECORD_LENGTH);
+            const auto l_eccOffset = readUInt16LE(l_recordDetailsItr);
 
-            l_recordData = std::make_tuple(l_recordOffset, l_recordLength,
-                                           l_eccOffset, l_eccLength);
-            break;
+            std::ranges::advance(l_recordDetailsItr, Length::RECORD_ECC_OFFSET);
+            const auto l_eccLength = readUInt16LE(l_recordDetailsItr);
+
+            // Keep the first occurrence, in case a record is repeated.
+            m_recordIndex.try_emplace(
+                l_recordName, std::make_tuple(l_recordOffset, l_recordLength,
+                                              l_eccOffset, l_eccLength));
+
+            std::ranges::advance(l_vtocPTItr, Length::SKIP_A_RECORD_IN_PT,
+                                 l_vtocPTKwValue.cend());
         }
+    }
 
-        std::ranges::advance(l_vtocPTItr, Length::SKIP_A_RECORD_IN_PT,
-                             l_vtocPTKwValue.cend());
+    if (auto l_itr = m_recordIndex.find(i_recordName);
+        l_itr != m_recordIndex.end())
+    {
+        return l_itr->second;
     }
 
-    return l_recordData;
+    return types::RecordData{};
 }
 
 types::DbusVariantType IpzVpdParser::readKeywordFromHardware(
@@ -617,110 +680,119 @@ void IpzVpdParser::updateRecordECC(
             "ECC update failed with error " + std::to_string(l_eccStatus)));
     }
 
-    auto l_recordECCEnd = std::next(l_recordECCBegin, i_recordECCLength);
-
-    m_vpdFileStream.seekp(m_vpdStartOffset + i_recordECCOffset, std::ios::beg);
-
-    std::copy(l_recordECCBegin, l_recordECCEnd,
-              std::ostreambuf_iterator<char>(m_vpdFileStream));
+    // ECC is written on hardware along with other changed bytes.
+    markRangeDirty(i_recordECCOffset, i_recordECCLength, io_vpdVector);
 }
 
-int IpzVpdParser::setKeywordValueInRecord(
-    const types::Record& i_recordName, const types::Keyword& i_keywordName,
-    const types::BinaryVector& i_keywordData,
-    const types::RecordOffset& i_recordDataOffset,
-    types::BinaryVector& io_vpdVector)
+void IpzVpdParser::markRangeDirty(size_t i_offset, size_t i_length,
+                                  const types::BinaryVector& i_vpdVector)
 {
-    auto l_iterator = io_vpdVector.begin();
+    const size_t l_end =
+        std::min({i_offset + i_length, i_vpdVector.size(), m_vpdVector.size()});
 
-    // Go to the record name in the given record's offset
-    std::ranges::advance(l_iterator,
-                         i_recordDataOffset + Length::JUMP_TO_RECORD_NAME,
-                         io_vpdVector.end());
+    // Track only the span of bytes which differ from what is on hardware.
+    size_t l_firstChanged = i_offset;
+    while (l_firstChanged < l_end &&
+           i_vpdVector[l_firstChanged] == m_vpdVector[l_firstChanged])
+    {
+        ++l_firstChanged;
+    }
 
-    const std::string l_recordFound(
-        l_iterator,
-        std::ranges::next(l_iterator, Length::RECORD_NAME, io_vpdVector.end()));
+    if (l_firstChanged == l_end)
+    {
+        // Nothing changed.
+        return;
+    }
 
-    // Check if the record is present in the given record's offset
-    if (i_recordName != l_recordFound)
+    size_t l_lastChanged = l_end - 1;
+    while (i_vpdVector[l_lastChanged] == m_vpdVector[l_lastChanged])
     {
-        throw(DataException("Given record found at the offset " +
-                            std::to_string(i_recordDataOffset) + " is : " +
-                            l_recordFound + " and not " + i_recordName));
+        --l_lastChanged;
     }
 
-    std::ranges::advance(l_iterator, Length::RECORD_NAME, io_vpdVector.end());
+    m_dirtyRanges.emplace_back(l_firstChanged,
+                               l_lastChanged - l_firstChanged + 1);
+}
 
-    std::string l_kwName = std::string(
-        l_iterator,
-        std::ranges::next(l_iterator, Length::KW_NAME, io_vpdVector.end()));
+size_t IpzVpdParser::writeDirtyRanges(const types::BinaryVector& i_vpdVector)
+{
+    // Bytes in between two dirty ranges of a page are unchanged and are
+    // written with their current value.
+    const auto l_writes = vpdSpecificUtility::getPageAlignedWrites(
+        std::exchange(m_dirtyRanges, {}), m_vpdStartOffset, m_writePageSize);
 
-    // Iterate through the keywords until the last keyword PF is found.
-    while (l_kwName != constants::LAST_KW)
+    size_t l_bytesWritten = 0;
+    for (const auto& [l_blockBegin, l_length] : l_writes)
     {
-        // First character required for #D keyword check
-        char l_kwNameStart = *l_iterator;
+        const auto l_blockData = std::next(i_vpdVector.cbegin(), l_blockBegin);
 
-        std::ranges::advance(l_iterator, Length::KW_NAME, io_vpdVector.end());
+        m_vpdFileStream.seekp(m_vpdStartOffset + l_blockBegin, std::ios::beg);
+        m_vpdFileStream.write(reinterpret_cast<const char*>(&l_blockData[0]),
+                              l_length);
+        m_vpdFileStream.flush();
 
-        // Find the keyword's data length
-        size_t l_kwdDataLength = 0;
+        // Verify the write by reading back only the bytes written.
+        types::BinaryVector l_readBack(l_length);
+        m_vpdFileStream.seekg(m_vpdStartOffset + l_blockBegin, std::ios::beg);
+        m_vpdFileStream.read(reinterpret_cast<char*>(l_readBack.data()),
+                             l_length);
 
-        if (constants::POUND_KW == l_kwNameStart)
-        {
-            l_kwdDataLength = readUInt16LE(l_iterator);
-            std::ranges::advance(l_iterator, sizeof(types::PoundKwSize),
-                                 io_vpdVector.end());
-        }
-        else
+        if (!std::equal(l_readBack.cbegin(), l_readBack.cend(), l_blockData))
         {
-            l_kwdDataLength = *l_iterator;
-            std::ranges::advance(l_iterator, sizeof(types::KwSize),
-                                 io_vpdVector.end());
+            throw(DataException(
+                "Read back verification failed for " +
+                std::to_string(l_length) + " bytes at offset " +
+                std::to_string(m_vpdStartOffset + l_blockBegin) + " of " +
+                m_vpdFilePath));
         }
 
-        if (l_kwName == i_keywordName)
-        {
-            // Before writing the keyword's value, get the maximum size that can
-            // be updated.
-            const auto l_lengthToUpdate =
-                i_keywordData.size() <= l_kwdDataLength
-                    ? i_keywordData.size()
-                    : l_kwdDataLength;
-
-            // Set the keyword's value on vector. This is required to update the
-            // record's ECC based on the new value set.
-            const auto i_keywordDataEnd = std::ranges::next(
-                i_keywordData.cbegin(), l_lengthToUpdate, i_keywordData.cend());
-
-            std::copy(i_keywordData.cbegin(), i_keywordDataEnd, l_iterator);
-
-            // Set the keyword's value on hardware
-            const auto l_kwdDataOffset =
-                std::distance(io_vpdVector.begin(), l_iterator);
-            m_vpdFileStream.seekp(m_vpdStartOffset + l_kwdDataOffset,
-                                  std::ios::beg);
-
-            std::copy(i_keywordData.cbegin(), i_keywordDataEnd,
-                      std::ostreambuf_iterator<char>(m_vpdFileStream));
-
-            // return no of bytes set
-            return l_lengthToUpdate;
-        }
+        // Keep held VPD same as hardware, for later updates to compare with.
+        std::copy_n(l_blockData, l_length,
+                    std::next(m_vpdVector.begin(), l_blockBegin));
 
-        // next keyword search
-        std::ranges::advance(l_iterator, l_kwdDataLength, io_vpdVector.end());
+        l_bytesWritten += l_length;
+    }
 
-        // next keyword name
-        l_kwName = std::string(
-            l_iterator,
-            std::ranges::next(l_iterator, Length::KW_NAME, io_vpdVector.end()));
+    return l_bytesWritten;
+}
+
+int IpzVpdParser::setKeywordValueInRecord(
+    const types::Record& i_recordName, const types::Keyword& i_keywordName,
+    const types::BinaryVector& i_keywordData,
+    const types::RecordOffset& i_recordDataOffset,
+    types::BinaryVector& io_vpdVector)
+{
+    // io_vpdVector is a copy of m_vpdVector, so the keyword index built on
+    // m_vpdVector holds good for it as well.
+    const auto& l_keywordIndex =
+        getKeywordIndex(i_recordName, i_recordDataOffset);
+
+    auto l_kwItr = l_keywordIndex.find(i_keywordName);
+    if (l_kwItr == l_keywordIndex.end())
+    {
+        // Keyword not found
+        throw(DataException("Keyword " + i_keywordName +
+                            " not found in record " + i_recordName));
     }
 
-    // Keyword not found
-    throw(DataException(
-        "Keyword " + i_keywordName + " not found in record " + i_recordName));
+    const auto& [l_kwdDataOffset, l_kwdDataLength] = l_kwItr->second;
+
+    // Before writing the keyword's value, get the maximum size that can be
+    // updated.
+    const auto l_lengthToUpdate = i_keywordData.size() <= l_kwdDataLength
+                                      ? i_keywordData.size()
+                                      : l_kwdDataLength;
+
+    // Set the keyword's value on vector. This is required to update the
+    // record's ECC based on the new value set.
+    std::copy_n(i_keywordData.cbegin(), l_lengthToUpdate,
+                std::next(io_vpdVector.begin(), l_kwdDataOffset));
+
+    // Track the changed bytes, to be written on hardware.
+    markRangeDirty(l_kwdDataOffset, l_lengthToUpdate, io_vpdVector);
+
+    // return no of bytes set
+    return l_lengthToUpdate;
 }
 
 int IpzVpdParser::writeKeywordOnHardware(
@@ -782,8 +854,9 @@ int IpzVpdParser::writeKeywordOnHardware(
         }
 
         // Create a local copy of m_vpdVector to perform keyword update and ecc
-        // update on filestream.
+        // update, only the changed bytes are then written on filestream.
         types::BinaryVector l_vpdVector = m_vpdVector;
+        m_dirtyRanges.clear();
 
         // write keyword's value on hardware
         l_sizeWritten =
@@ -801,6 +874,9 @@ int IpzVpdParser::writeKeywordOnHardware(
                         std::get<2>(l_inputRecordDetails),
                         std::get<3>(l_inputRecordDetails), l_vpdVector);
 
+        // Write the changed bytes on hardware
+        writeDirtyRanges(l_vpdVector);
+
         logging::logMessage(std::to_string(l_sizeWritten) +
                             " bytes updated successfully on hardware for " +
                             l_recordName + ":" + l_keywordName);
@@ -813,6 +889,123 @@ int IpzVpdParser::writeKeywordOnHardware(
     return l_sizeWritten;
 }
 
+int IpzVpdParser::writeKeywordsOnHardware(
+    const types::ListOfWriteVpdParams& i_paramsToWriteData)
+{
+    if (i_paramsToWriteData.empty())
+    {
+        logging::logMessage("Write operation not allowed as no keyword given.");
+        throw types::DbusInvalidArgument();
+    }
+
+    // Validate all the inputs before touching the hardware, so that an
+    // invalid entry doesn't leave the VPD partially updated.
+    for (const auto& l_paramsToWrite : i_paramsToWriteData)
+    {
+        const types::IpzData* l_ipzData =
+            std::get_if<types::IpzData>(&l_paramsToWrite);
+
+        if (l_ipzData == nullptr)
+        {
+            logging::logMessage(
+                "Input parameter type provided isn't compatible with the given FRU's VPD type.");
+            throw types::DbusInvalidArgument();
+        }
+
+        const auto& l_recordName = std::get<0>(*l_ipzData);
+
+        if (l_recordName == "VHDR" || l_recordName == "VTOC")
+        {
+            logging::logMessage(
+                "Write operation not allowed on the given record : " +
+                l_recordName);
+            throw types::DbusNotAllowed();
+        }
+
+        if (std::get<2>(*l_ipzData).size() == 0)
+        {
+            logging::logMessage(
+                "Write operation not allowed as the given keyword's data length is 0.");
+            throw types::DbusInvalidArgument();
+        }
+    }
+
+    auto l_vpdBegin = m_vpdVector.begin();
+
+    // Get VTOC offset
+    std::ranges::advance(l_vpdBegin, Offset::VTOC_PTR, m_vpdVector.end());
+    auto l_vtocOffset = readUInt16LE(l_vpdBegin);
+
+    // Create a local copy of m_vpdVector to perform all the keyword updates and
+    // ECC updates, only the changed bytes are then written on filestream.
+    types::BinaryVector l_vpdVector = m_vpdVector;
+    m_dirtyRanges.clear();
+
+    // Records touched by this write, in the order they are first seen.
+    std::vector<std::pair<types::Record, types::RecordData>> l_recordsToUpdate;
+
+    int l_totalSizeWritten = 0;
+
+    for (const auto& l_paramsToWrite : i_paramsToWriteData)
+    {
+        const auto& [l_recordName, l_keywordName, l_keywordData] =
+            std::get<types::IpzData>(l_paramsToWrite);
+
+        auto l_recordItr = std::ranges::find(
+            l_recordsToUpdate, l_recordName,
+            &std::pair<types::Record, types::RecordData>::first);
+
+        if (l_recordItr == l_recordsToUpdate.end())
+        {
+            // Get the details of user given record from VTOC
+            const types::RecordData l_recordDetails =
+                getRecordDetailsFromVTOC(l_recordName, l_vtocOffset);
+
+            if (std::get<0>(l_recordDetails) == 0)
+            {
+                throw(DataException(
+                    "Record " + l_recordName + " not found in VTOC PT keyword."));
+            }
+
+            l_recordItr = l_recordsToUpdate.emplace(
+                l_recordsToUpdate.end(), l_recordName, l_recordDetails);
+        }
+
+        // write keyword's value on hardware
+        const auto l_sizeWritten = setKeywordValueInRecord(
+            l_recordName, l_keywordName, l_keywordData,
+            std::get<0>(l_recordItr->second), l_vpdVector);
+
+        if (l_sizeWritten <= 0)
+        {
+            throw(DataException("Unable to set value on " + l_recordName + ":" +
+                                l_keywordName));
+        }
+
+        l_totalSizeWritten += l_sizeWritten;
+    }
+
+    // Update ECC once for every record touched.
+    for (const auto& [l_recordName, l_recordDetails] : l_recordsToUpdate)
+    {
+        updateRecordECC(std::get<0>(l_recordDetails),
+                        std::get<1>(l_recordDetails),
+                        std::get<2>(l_recordDetails),
+                        std::get<3>(l_recordDetails), l_vpdVector);
+    }
+
+    // Write the changed bytes on hardware
+    writeDirtyRanges(l_vpdVector);
+
+    logging::logMessage(
+        std::to_string(l_totalSizeWritten) +
+        " bytes updated successfully on hardware for " +
+        std::to_string(i_paramsToWriteData.size()) + " keyword(s) across " +
+        std::to_string(l_recordsToUpdate.size()) + " record(s)");
+
+    return l_totalSizeWritten;
+}
+
 bool IpzVpdParser::processInvalidRecords(
     const types::InvalidRecordList& i_invalidRecordList) const noexcept
 {
@@ -2,6 +2,7 @@
 
 #include "constants.hpp"
 #include "logger.hpp"
+#include "metrics.hpp"
 
 #include <algorithm>
 #include <iostream>
@@ -327,6 +328,8 @@ types::JedecSpdMap JedecSpdParser::readKeywords(
 
 types::VPDMapVariant JedecSpdParser::parse()
 {
+    const ScopedLatency l_latency(Histogram::IsdimmParseLatency);
+
     // Read the data and return the map
     auto l_iterator = m_memSpd.cbegin();
     auto l_spdDataMap = readKeywords(l_iterator);
@@ -3,6 +3,7 @@
 #include "constants.hpp"
 #include "exceptions.hpp"
 #include "logger.hpp"
+#include "metrics.hpp"
 
 #include <iostream>
 #include <numeric>
@@ -13,6 +14,8 @@ namespace vpd
 
 types::VPDMapVariant KeywordVpdParser::parse()
 {
+    const ScopedLatency l_latency(Histogram::KeywordParseLatency);
+
     if (m_keywordVpdVector.empty())
     {
         throw(DataException("Vector for Keyword format VPD is empty"));
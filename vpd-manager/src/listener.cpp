@@ -9,12 +9,15 @@
 #include "utility/json_utility.hpp"
 #include "utility/vpd_specific_utility.hpp"
 
+#include <algorithm>
+
 namespace vpd
 {
 Listener::Listener(
     const std::shared_ptr<Worker>& i_worker,
     const std::shared_ptr<sdbusplus::asio::connection>& i_asioConnection) :
-    m_worker(i_worker), m_asioConnection(i_asioConnection)
+    m_worker(i_worker), m_asioConnection(i_asioConnection),
+    m_correlatedPropTimer(i_asioConnection->get_io_context())
 {
     if (m_worker == nullptr)
     {
@@ -35,6 +38,15 @@ void Listener::registerHostStateChangeCallback() const noexcept
                 [this](sdbusplus::message_t& i_msg) {
                     hostStateChangeCallBack(i_msg);
                 });
+
+        // Seed the cache only after the match is in place, so that no change
+        // is missed.
+        if (const auto l_hostRunning = dbusUtility::readSystemState(
+                dbusUtility::SystemState::HostRunning))
+        {
+            dbusUtility::setCachedSystemState(
+                dbusUtility::SystemState::HostRunning, *l_hostRunning);
+        }
     }
     catch (const std::exception& l_ex)
     {
@@ -62,7 +74,7 @@ void Listener::hostStateChangeCallBack(
         types::PropertyMap l_propMap;
         i_msg.read(l_objectPath, l_propMap);
 
-        const auto l_itr = l_propMap.find("CurrentHostState");
+        const auto l_itr = l_propMap.find(constants::currentHostStateProperty);
 
         if (l_itr == l_propMap.end())
         {
@@ -72,6 +84,10 @@ void Listener::hostStateChangeCallBack(
 
         if (auto l_hostState = std::get_if<std::string>(&(l_itr->second)))
         {
+            dbusUtility::setCachedSystemState(
+                dbusUtility::SystemState::HostRunning,
+                *l_hostState == constants::hostRunningState);
+
             // implies system is moving from standby to power on state
             if (*l_hostState == "xyz.openbmc_project.State.Host.HostState."
                                 "TransitioningToRunning")
@@ -107,6 +123,94 @@ void Listener::hostStateChangeCallBack(
     }
 }
 
+void Listener::registerSystemStateChangeCallback() noexcept
+{
+    // Host state is cached by the host state change callback.
+    for (const auto l_state : {dbusUtility::SystemState::ChassisPowerOn,
+                               dbusUtility::SystemState::BmcReady})
+    {
+        const auto& l_stateProperty =
+            dbusUtility::getSystemStateProperty(l_state);
+        try
+        {
+            m_systemStateMatchObjects.emplace_back(
+                std::make_shared<sdbusplus::bus::match_t>(
+                    *m_asioConnection,
+                    sdbusplus::bus::match::rules::propertiesChanged(
+                        l_stateProperty.m_objectPath,
+                        l_stateProperty.m_interface),
+                    [this, l_state](sdbusplus::message_t& i_msg) {
+                        systemStateChangeCallBack(l_state, i_msg);
+                    }));
+
+            // Seed the cache only after the match is in place, so that no
+            // change is missed. If the state can't be read, it is left
+            // uncached till a change is received.
+            if (const auto l_value = dbusUtility::readSystemState(l_state))
+            {
+                dbusUtility::setCachedSystemState(l_state, *l_value);
+            }
+        }
+        catch (const std::exception& l_ex)
+        {
+            EventLogger::createSyncPel(
+                EventLogger::getErrorType(l_ex),
+                types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
+                "Register state change callback failed for " +
+                    std::string(l_stateProperty.m_property) +
+                    ", reason: " + std::string(l_ex.what()),
+                std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+        }
+    }
+}
+
+void Listener::systemStateChangeCallBack(
+    dbusUtility::SystemState i_state,
+    sdbusplus::message_t& i_msg) const noexcept
+{
+    const auto& l_stateProperty = dbusUtility::getSystemStateProperty(i_state);
+    try
+    {
+        if (i_msg.is_method_error())
+        {
+            throw std::runtime_error(
+                "Error reading callback message for " +
+                std::string(l_stateProperty.m_property));
+        }
+
+        std::string l_interface;
+        types::PropertyMap l_propMap;
+        i_msg.read(l_interface, l_propMap);
+
+        const auto l_itr = l_propMap.find(l_stateProperty.m_property);
+        if (l_itr == l_propMap.end())
+        {
+            return;
+        }
+
+        if (const auto l_value = std::get_if<std::string>(&(l_itr->second)))
+        {
+            dbusUtility::setCachedSystemState(
+                i_state, *l_value == l_stateProperty.m_value);
+        }
+        else
+        {
+            throw std::runtime_error(
+                "Invalid type received in variant for " +
+                std::string(l_stateProperty.m_property));
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        EventLogger::createSyncPel(
+            EventLogger::getErrorType(l_ex), types::SeverityType::Informational,
+            __FILE__, __FUNCTION__, 0,
+            "State change callback failed, reason: " +
+                std::string(l_ex.what()),
+            std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+    }
+}
+
 void Listener::registerAssetTagChangeCallback() const noexcept
 {
     try
@@ -188,7 +292,7 @@ void Listener::registerPresenceChangeCallback() noexcept
         uint16_t l_errCode = 0;
         // get list of FRUs for which presence monitoring is required
         const auto& l_listOfFrus = jsonUtility::getFrusWithPresenceMonitoring(
-            m_worker->getSysCfgJsonObj(), l_errCode);
+            *m_worker->getSysCfgJsonObj(), l_errCode);
 
         if (l_errCode)
         {
@@ -198,20 +302,26 @@ void Listener::registerPresenceChangeCallback() noexcept
             return;
         }
 
-        for (const auto& l_inventoryPath : l_listOfFrus)
+        if (l_listOfFrus.empty())
         {
-            std::shared_ptr<sdbusplus::bus::match_t> l_fruPresenceMatch =
-                std::make_shared<sdbusplus::bus::match_t>(
-                    *m_asioConnection,
-                    sdbusplus::bus::match::rules::propertiesChanged(
-                        l_inventoryPath, constants::inventoryItemInf),
-                    [this](sdbusplus::message_t& i_msg) {
-                        presentPropertyChangeCallback(i_msg);
-                    });
-
-            // save the match object to map
-            m_fruPresenceMatchObjectMap[l_inventoryPath] = l_fruPresenceMatch;
+            return;
         }
+
+        m_presenceMonitoredPaths.insert(l_listOfFrus.begin(),
+                                        l_listOfFrus.end());
+
+        // A single match for the whole inventory namespace, instead of a match
+        // per FRU. Signals of FRUs not monitored are dropped in the callback.
+        namespace rules = sdbusplus::bus::match::rules;
+        m_fruPresenceMatch = std::make_shared<sdbusplus::bus::match_t>(
+            *m_asioConnection,
+            rules::type::signal() + rules::member("PropertiesChanged") +
+                rules::interface("org.freedesktop.DBus.Properties") +
+                rules::path_namespace(constants::pimPath) +
+                rules::argN(0, constants::inventoryItemInf),
+            [this](sdbusplus::message_t& i_msg) {
+                presentPropertyChangeCallback(i_msg);
+            });
     }
     catch (const std::exception& l_ex)
     {
@@ -235,12 +345,18 @@ void Listener::presentPropertyChangeCallback(
                 "Error reading callback message for Present property change");
         }
 
+        const std::string l_objectPath{i_msg.get_path()};
+
+        if (!m_presenceMonitoredPaths.contains(l_objectPath))
+        {
+            // Presence of the FRU is not monitored.
+            return;
+        }
+
         std::string l_interface;
         types::PropertyMap l_propMap;
         i_msg.read(l_interface, l_propMap);
 
-        const std::string l_objectPath{i_msg.get_path()};
-
         const auto l_itr = l_propMap.find("Present");
         if (l_itr == l_propMap.end())
         {
@@ -276,7 +392,7 @@ void Listener::registerCorrPropCallBack(
     try
     {
         uint16_t l_errCode = 0;
-        m_correlatedPropJson =
+        const nlohmann::json l_correlatedPropJson =
             jsonUtility::getParsedJson(i_correlatedPropJsonFile, l_errCode);
 
         if (l_errCode)
@@ -287,8 +403,10 @@ void Listener::registerCorrPropCallBack(
                                 i_correlatedPropJsonFile);
         }
 
+        compileCorrelatedProps(l_correlatedPropJson);
+
         const nlohmann::json& l_serviceJsonObjectList =
-            m_correlatedPropJson.get_ref<const nlohmann::json::object_t&>();
+            l_correlatedPropJson.get_ref<const nlohmann::json::object_t&>();
 
         // Iterate through all services in the correlated properties json
         for (const auto& l_serviceJsonObject : l_serviceJsonObjectList.items())
@@ -296,7 +414,7 @@ void Listener::registerCorrPropCallBack(
             const auto& l_serviceName = l_serviceJsonObject.key();
 
             const nlohmann::json& l_correlatedIntfJsonObj =
-                m_correlatedPropJson[l_serviceName]
+                l_serviceJsonObject.value()
                     .get_ref<const nlohmann::json::object_t&>();
 
             // register properties changed D-Bus signal callback
@@ -311,6 +429,24 @@ void Listener::registerCorrPropCallBack(
                                       correlatedPropChangedCallBack(i_msg);
                                   });
                           });
+
+            // Track owner of the service, so that sender of a property change
+            // is mapped to the service without any D-Bus call.
+            m_nameOwnerMatchObjects.emplace_back(
+                std::make_shared<sdbusplus::bus::match_t>(
+                    *m_asioConnection,
+                    sdbusplus::bus::match::rules::nameOwnerChanged(
+                        l_serviceName),
+                    [this](sdbusplus::message_t& i_msg) {
+                        nameOwnerChangedCallBack(i_msg);
+                    }));
+
+            const std::string l_owner =
+                dbusUtility::getNameOwner(l_serviceName);
+            if (!l_owner.empty())
+            {
+                m_serviceNameMap[l_owner] = l_serviceName;
+            }
         } // service loop
     }
     catch (const std::exception& l_ex)
@@ -322,6 +458,143 @@ void Listener::registerCorrPropCallBack(
     }
 }
 
+void Listener::compileCorrelatedProps(
+    const nlohmann::json& i_correlatedPropJson)
+{
+    for (const auto& l_serviceJsonObject : i_correlatedPropJson.items())
+    {
+        const std::string& l_serviceName = l_serviceJsonObject.key();
+
+        for (const auto& l_interfaceJsonObject :
+             l_serviceJsonObject.value().items())
+        {
+            const std::string& l_interface = l_interfaceJsonObject.key();
+
+            for (const auto& l_propertyJsonObject :
+                 l_interfaceJsonObject.value().items())
+            {
+                const std::string& l_property = l_propertyJsonObject.key();
+                const nlohmann::json& l_destinationJsonObj =
+                    l_propertyJsonObject.value();
+
+                if (l_destinationJsonObj.contains("pathsPair"))
+                {
+                    for (const auto& l_pathsPairJsonObject :
+                         l_destinationJsonObj["pathsPair"].items())
+                    {
+                        const nlohmann::json& l_pathsPair =
+                            l_pathsPairJsonObject.value();
+                        if (!l_pathsPair.contains("destinationInventoryPath") ||
+                            !l_pathsPair.contains("interfaces"))
+                        {
+                            continue;
+                        }
+
+                        types::DbusPropertyList l_destinations;
+                        for (const auto& l_destinationInterfaceJsonObj :
+                             l_pathsPair["interfaces"].items())
+                        {
+                            for (const auto& l_destinationInventoryPath :
+                                 l_pathsPair["destinationInventoryPath"])
+                            {
+                                l_destinations.emplace_back(
+                                    l_destinationInventoryPath,
+                                    l_destinationInterfaceJsonObj.key(),
+                                    l_destinationInterfaceJsonObj.value());
+                            }
+                        }
+
+                        m_correlatedPropsMap.emplace(
+                            getCorrelatedPropKey(l_serviceName, l_interface,
+                                                 l_property,
+                                                 l_pathsPairJsonObject.key()),
+                            std::move(l_destinations));
+                    }
+                }
+
+                if (l_destinationJsonObj.contains("defaultInterfaces"))
+                {
+                    types::DbusPropertyList l_destinations;
+                    for (const auto& l_destinationIfcPropEntry :
+                         l_destinationJsonObj["defaultInterfaces"].items())
+                    {
+                        l_destinations.emplace_back(
+                            std::string{}, l_destinationIfcPropEntry.key(),
+                            l_destinationIfcPropEntry.value());
+                    }
+
+                    m_correlatedPropsMap.emplace(
+                        getCorrelatedPropKey(l_serviceName, l_interface,
+                                             l_property, std::string{}),
+                        std::move(l_destinations));
+                }
+            }
+        }
+    }
+}
+
+std::string Listener::getCorrelatedPropKey(const std::string& i_serviceName,
+                                           const std::string& i_interface,
+                                           const std::string& i_property,
+                                           const std::string& i_objectPath)
+{
+    // '|' can't be part of any D-Bus name or object path.
+    return i_serviceName + "|" + i_interface + "|" + i_property + "|" +
+           i_objectPath;
+}
+
+std::string Listener::getServiceName(const std::string& i_connectionId) noexcept
+{
+    const auto l_itr = m_serviceNameMap.find(i_connectionId);
+    if (l_itr != m_serviceNameMap.end())
+    {
+        return l_itr->second;
+    }
+
+    std::string l_serviceName =
+        dbusUtility::getServiceNameFromConnectionId(i_connectionId);
+
+    // if service name contains .service suffix, strip it
+    const std::size_t l_pos = l_serviceName.find(".service");
+    if (l_pos != std::string::npos)
+    {
+        l_serviceName = l_serviceName.substr(0, l_pos);
+    }
+
+    if (!l_serviceName.empty())
+    {
+        m_serviceNameMap.emplace(i_connectionId, l_serviceName);
+    }
+    return l_serviceName;
+}
+
+void Listener::nameOwnerChangedCallBack(sdbusplus::message_t& i_msg) noexcept
+{
+    try
+    {
+        std::string l_serviceName;
+        std::string l_oldOwner;
+        std::string l_newOwner;
+        i_msg.read(l_serviceName, l_oldOwner, l_newOwner);
+
+        if (!l_oldOwner.empty())
+        {
+            m_serviceNameMap.erase(l_oldOwner);
+        }
+
+        if (!l_newOwner.empty())
+        {
+            m_serviceNameMap[l_newOwner] = l_serviceName;
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage(
+            "Failed to process name owner change, error: " +
+            std::string(l_ex.what()));
+    }
+}
+
 void Listener::registerPropChangeCallBack(
     const std::string& i_service, const std::string& i_interface,
     std::function<void(sdbusplus::message_t& i_msg)> i_callBackFunction)
@@ -367,8 +640,7 @@ void Listener::correlatedPropChangedCallBack(
 
         const std::string l_objectPath{i_msg.get_path()};
 
-        std::string l_serviceName =
-            dbusUtility::getServiceNameFromConnectionId(i_msg.get_sender());
+        const std::string l_serviceName = getServiceName(i_msg.get_sender());
 
         if (l_serviceName.empty())
         {
@@ -377,13 +649,6 @@ void Listener::correlatedPropChangedCallBack(
                 std::string(i_msg.get_sender()));
         }
 
-        // if service name contains .service suffix, strip it
-        const std::size_t l_pos = l_serviceName.find(".service");
-        if (l_pos != std::string::npos)
-        {
-            l_serviceName = l_serviceName.substr(0, l_pos);
-        }
-
         // iterate through all properties in map
         for (const auto& l_propertyEntry : l_propMap)
         {
@@ -404,8 +669,8 @@ void Listener::correlatedPropChangedCallBack(
                  &l_interface = std::as_const(l_interface),
                  &l_propertyName = std::as_const(l_propertyName)](
                     const auto& i_corrProperty) {
-                    if (!updateCorrelatedProperty(l_serviceName, i_corrProperty,
-                                                  l_propertyValue))
+                    if (!queueCorrelatedPropertyUpdate(
+                            l_serviceName, i_corrProperty, l_propertyValue))
                     {
                         logging::logMessage(
                             "Failed to update correlated property: " +
@@ -435,52 +700,23 @@ types::DbusPropertyList Listener::getCorrelatedProps(
     types::DbusPropertyList l_result;
     try
     {
-        if (m_correlatedPropJson.contains(i_serviceName) &&
-            m_correlatedPropJson[i_serviceName].contains(i_interface) &&
-            m_correlatedPropJson[i_serviceName][i_interface].contains(
-                i_property))
-        {
-            const nlohmann::json& l_destinationJsonObj =
-                m_correlatedPropJson[i_serviceName][i_interface][i_property];
-
-            // check if any matching paths pair entry is present
-            if (l_destinationJsonObj.contains("pathsPair") &&
-                l_destinationJsonObj["pathsPair"].contains(i_objectPath) &&
-                l_destinationJsonObj["pathsPair"][i_objectPath].contains(
-                    "destinationInventoryPath") &&
-                l_destinationJsonObj["pathsPair"][i_objectPath].contains(
-                    "interfaces"))
-            {
-                // iterate through all the destination interface and property
-                // name
-                for (const auto& l_destinationInterfaceJsonObj :
-                     l_destinationJsonObj["pathsPair"][i_objectPath]
-                                         ["interfaces"]
-                                             .items())
-                {
-                    // iterate through all destination inventory paths
-                    for (const auto& l_destinationInventoryPath :
-                         l_destinationJsonObj["pathsPair"][i_objectPath]
-                                             ["destinationInventoryPath"])
-                    {
-                        l_result.emplace_back(
-                            l_destinationInventoryPath,
-                            l_destinationInterfaceJsonObj.key(),
-                            l_destinationInterfaceJsonObj.value());
-                    } // destination inventory paths
-                } // destination interfaces
-            }
-            // get the default interface, property to update
-            else if (l_destinationJsonObj.contains("defaultInterfaces"))
+        // check if any matching paths pair entry is present
+        auto l_itr = m_correlatedPropsMap.find(getCorrelatedPropKey(
+            i_serviceName, i_interface, i_property, i_objectPath));
+        if (l_itr != m_correlatedPropsMap.end())
+        {
+            return l_itr->second;
+        }
+
+        // get the default interface, property to update
+        l_itr = m_correlatedPropsMap.find(getCorrelatedPropKey(
+            i_serviceName, i_interface, i_property, std::string{}));
+        if (l_itr != m_correlatedPropsMap.end())
+        {
+            for (const auto& l_destination : l_itr->second)
             {
-                // iterate through all default interfaces to update
-                for (const auto& l_destinationIfcPropEntry :
-                     l_destinationJsonObj["defaultInterfaces"].items())
-                {
-                    l_result.emplace_back(i_objectPath,
-                                          l_destinationIfcPropEntry.key(),
-                                          l_destinationIfcPropEntry.value());
-                }
+                l_result.emplace_back(i_objectPath, std::get<1>(l_destination),
+                                      std::get<2>(l_destination));
             }
         }
     }
@@ -491,10 +727,10 @@ types::DbusPropertyList Listener::getCorrelatedProps(
     return l_result;
 }
 
-bool Listener::updateCorrelatedProperty(
+bool Listener::queueCorrelatedPropertyUpdate(
     const std::string& i_serviceName,
     const types::DbusPropertyEntry& i_corrProperty,
-    const types::DbusVariantType& i_propertyValue) const noexcept
+    const types::DbusVariantType& i_propertyValue) noexcept
 {
     const auto& l_destinationObjectPath{std::get<0>(i_corrProperty)};
     const auto& l_destinationInterface{std::get<1>(i_corrProperty)};
@@ -555,29 +791,108 @@ bool Listener::updateCorrelatedProperty(
             }
         }
 
+        const bool l_isQueueEmpty =
+            m_queuedPimUpdates.empty() && m_queuedPropertyUpdates.empty();
+
         if (i_serviceName == constants::pimServiceName)
         {
-            // Call dbus method to update on dbus
-            return dbusUtility::publishVpdOnDBus(types::ObjectMap{
-                {l_destinationObjectPath,
-                 {{l_destinationInterface,
-                   {{l_destinationPropertyName, l_valueToUpdate}}}}}});
+            auto& l_interfaceMap = m_queuedPimUpdates[
+                sdbusplus::message::object_path(l_destinationObjectPath)];
+            l_interfaceMap[l_destinationInterface][l_destinationPropertyName] =
+                l_valueToUpdate;
         }
         else
         {
-            return dbusUtility::writeDbusProperty(
-                i_serviceName, l_destinationObjectPath, l_destinationInterface,
-                l_destinationPropertyName, l_valueToUpdate);
+            m_queuedPropertyUpdates[i_serviceName][i_corrProperty] =
+                l_valueToUpdate;
+        }
+
+        const auto l_now = std::chrono::steady_clock::now();
+        if (l_isQueueEmpty)
+        {
+            m_correlatedPropDeadline =
+                l_now + std::chrono::milliseconds(
+                            constants::CORRELATED_PROP_UPDATE_MAX_LATENCY_MS);
         }
+
+        // Timer is re-armed on every update, which cancels the wait in
+        // progress. Queued updates are sent once the updates stop coming, but
+        // not later than the deadline.
+        m_correlatedPropTimer.expires_at(
+            std::min(l_now + std::chrono::milliseconds(
+                                 constants::CORRELATED_PROP_UPDATE_DEBOUNCE_MS),
+                     m_correlatedPropDeadline));
+        m_correlatedPropTimer.async_wait(
+            [this](const boost::system::error_code& i_errorCode) {
+                if (i_errorCode != boost::asio::error::operation_aborted)
+                {
+                    updateQueuedCorrelatedProperties();
+                }
+            });
+        return true;
     }
     catch (const std::exception& l_ex)
     {
         logging::logMessage(
-            "Failed to update correlated property: " + i_serviceName + " : " +
+            "Failed to queue correlated property: " + i_serviceName + " : " +
             l_destinationObjectPath + " : " + l_destinationInterface + " : " +
             l_destinationPropertyName + ". Error: " + std::string(l_ex.what()));
     }
     return false;
 }
 
+void Listener::updateQueuedCorrelatedProperties() noexcept
+{
+    try
+    {
+        if (!m_queuedPimUpdates.empty())
+        {
+            const size_t l_objectCount = m_queuedPimUpdates.size();
+            if (!dbusUtility::publishVpdOnDBus(std::move(m_queuedPimUpdates)))
+            {
+                logging::logMessage(
+                    "Failed to update correlated properties of " +
+                    std::to_string(l_objectCount) + " object(s) on PIM.");
+            }
+            m_queuedPimUpdates.clear();
+        }
+
+        for (const auto& [l_serviceName, l_propertyUpdates] :
+             m_queuedPropertyUpdates)
+        {
+            for (const auto& [l_corrProperty, l_value] : l_propertyUpdates)
+            {
+                const auto& [l_objectPath, l_interface, l_propertyName] =
+                    l_corrProperty;
+
+                m_asioConnection->async_method_call(
+                    [l_serviceName, l_corrProperty](
+                        const boost::system::error_code& i_errorCode) {
+                        if (i_errorCode)
+                        {
+                            logging::logMessage(
+                                "Failed to update correlated property: " +
+                                l_serviceName + " : " +
+                                std::get<0>(l_corrProperty) + " : " +
+                                std::get<1>(l_corrProperty) + " : " +
+                                std::get<2>(l_corrProperty) + ". Error: " +
+                                i_errorCode.message());
+                        }
+                    },
+                    l_serviceName, l_objectPath,
+                    "org.freedesktop.DBus.Properties", "Set", l_interface,
+                    l_propertyName, l_value);
+            }
+        }
+        m_queuedPropertyUpdates.clear();
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_queuedPimUpdates.clear();
+        m_queuedPropertyUpdates.clear();
+        logging::logMessage("Failed to update correlated properties. Error: " +
+                            std::string(l_ex.what()));
+    }
+}
+
 } // namespace vpd
@@ -4,15 +4,18 @@
 
 #include "constants.hpp"
 #include "exceptions.hpp"
+#include "metrics.hpp"
 #include "parser.hpp"
 #include "parser_factory.hpp"
 #include "parser_interface.hpp"
 #include "single_fab.hpp"
+#include "tracer.hpp"
 #include "types.hpp"
 #include "utility/dbus_utility.hpp"
 #include "utility/json_utility.hpp"
 #include "utility/vpd_specific_utility.hpp"
 
+#include <boost/asio/spawn.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message.hpp>
@@ -27,90 +30,122 @@ Manager::Manager(
     m_ioContext(ioCon), m_interface(iFace), m_progressInterface(progressiFace),
     m_asioConnection(asioConnection), m_logger(Logger::getLoggerInstance())
 {
-#ifdef IBM_SYSTEM_SINGLE_FAB
-    if (!dbusUtility::isChassisPowerOn())
-    {
-        SingleFab l_singleFab;
-        const int& l_rc = l_singleFab.singleFabImOverride();
-
-        if (l_rc == constants::FAILURE)
-        {
-            throw std::runtime_error(
-                std::string(__FUNCTION__) +
-                " : Found an invalid system configuration. Needs manual intervention. BMC is being quiesced.");
-        }
-    }
-#endif
-
     try
     {
+        // Methods are registered as coroutines. Any hardware or D-Bus access
+        // is executed on the thread pool, keeping the IO context free to serve
+        // other requests in the meantime.
+
         // For backward compatibility. Should be depricated.
         iFace->register_method(
             "WriteKeyword",
-            [this](const sdbusplus::message::object_path i_path,
+            [this](boost::asio::yield_context i_yield,
+                   const sdbusplus::message::object_path i_path,
                    const std::string i_recordName, const std::string i_keyword,
                    const types::BinaryVector i_value) -> int {
-                return this->updateKeyword(
-                    i_path, std::make_tuple(i_recordName, i_keyword, i_value));
+                return executeOnThreadPool(i_yield, [&]() {
+                    return this->updateKeyword(
+                        i_path,
+                        std::make_tuple(i_recordName, i_keyword, i_value));
+                });
             });
 
         // Register methods under com.ibm.VPD.Manager interface
         iFace->register_method(
             "UpdateKeyword",
-            [this](const types::Path i_vpdPath,
+            [this](boost::asio::yield_context i_yield,
+                   const types::Path i_vpdPath,
                    const types::WriteVpdParams i_paramsToWriteData) -> int {
-                return this->updateKeyword(i_vpdPath, i_paramsToWriteData);
+                return executeOnThreadPool(i_yield, [&]() {
+                    return this->updateKeyword(i_vpdPath, i_paramsToWriteData);
+                });
+            });
+
+        iFace->register_method(
+            "UpdateKeywords",
+            [this](boost::asio::yield_context i_yield,
+                   const types::Path i_vpdPath,
+                   const types::ListOfWriteVpdParams i_paramsToWriteData)
+                -> int {
+                return executeOnThreadPool(i_yield, [&]() {
+                    return this->updateKeywords(i_vpdPath, i_paramsToWriteData);
+                });
             });
 
         iFace->register_method(
             "WriteKeywordOnHardware",
-            [this](const types::Path i_fruPath,
+            [this](boost::asio::yield_context i_yield,
+                   const types::Path i_fruPath,
                    const types::WriteVpdParams i_paramsToWriteData) -> int {
-                return this->updateKeywordOnHardware(i_fruPath,
-                                                     i_paramsToWriteData);
+                return executeOnThreadPool(i_yield, [&]() {
+                    std::scoped_lock l_lock(m_vpdAccessMutex);
+                    return this->updateKeywordOnHardware(i_fruPath,
+                                                         i_paramsToWriteData);
+                });
             });
 
         iFace->register_method(
             "ReadKeyword",
-            [this](const types::Path i_fruPath,
+            [this](boost::asio::yield_context i_yield,
+                   const types::Path i_fruPath,
                    const types::ReadVpdParams i_paramsToReadData)
                 -> types::DbusVariantType {
-                return this->readKeyword(i_fruPath, i_paramsToReadData);
+                return executeOnThreadPool(i_yield, [&]() {
+                    std::shared_lock l_lock(m_vpdAccessMutex);
+                    return this->readKeyword(i_fruPath, i_paramsToReadData);
+                });
             });
 
         iFace->register_method(
             "CollectFRUVPD",
-            [this](const sdbusplus::message::object_path& i_dbusObjPath) {
-                this->collectSingleFruVpd(i_dbusObjPath);
+            [this](boost::asio::yield_context i_yield,
+                   const sdbusplus::message::object_path& i_dbusObjPath) {
+                this->collectSingleFruVpd(i_yield, i_dbusObjPath);
             });
 
         iFace->register_method(
             "deleteFRUVPD",
-            [this](const sdbusplus::message::object_path& i_dbusObjPath) {
-                this->deleteSingleFruVpd(i_dbusObjPath);
+            [this](boost::asio::yield_context i_yield,
+                   const sdbusplus::message::object_path& i_dbusObjPath) {
+                executeOnThreadPool(i_yield, [&]() {
+                    this->deleteSingleFruVpd(i_dbusObjPath);
+                });
             });
 
         iFace->register_method(
             "GetExpandedLocationCode",
-            [this](const std::string& i_unexpandedLocationCode,
+            [this](boost::asio::yield_context i_yield,
+                   const std::string& i_unexpandedLocationCode,
                    uint16_t& i_nodeNumber) -> std::string {
-                return this->getExpandedLocationCode(i_unexpandedLocationCode,
-                                                     i_nodeNumber);
+                return executeOnThreadPool(i_yield, [&]() {
+                    std::shared_lock l_lock(m_vpdAccessMutex);
+                    return this->getExpandedLocationCode(
+                        i_unexpandedLocationCode, i_nodeNumber);
+                });
             });
 
-        iFace->register_method("GetFRUsByExpandedLocationCode",
-                               [this](const std::string& i_expandedLocationCode)
-                                   -> types::ListOfPaths {
-                                   return this->getFrusByExpandedLocationCode(
-                                       i_expandedLocationCode);
-                               });
+        iFace->register_method(
+            "GetFRUsByExpandedLocationCode",
+            [this](boost::asio::yield_context i_yield,
+                   const std::string& i_expandedLocationCode)
+                -> types::ListOfPaths {
+                return executeOnThreadPool(i_yield, [&]() {
+                    std::shared_lock l_lock(m_vpdAccessMutex);
+                    return this->getFrusByExpandedLocationCode(
+                        i_expandedLocationCode);
+                });
+            });
 
         iFace->register_method(
             "GetFRUsByUnexpandedLocationCode",
-            [this](const std::string& i_unexpandedLocationCode,
+            [this](boost::asio::yield_context i_yield,
+                   const std::string& i_unexpandedLocationCode,
                    uint16_t& i_nodeNumber) -> types::ListOfPaths {
-                return this->getFrusByUnexpandedLocationCode(
-                    i_unexpandedLocationCode, i_nodeNumber);
+                return executeOnThreadPool(i_yield, [&]() {
+                    std::shared_lock l_lock(m_vpdAccessMutex);
+                    return this->getFrusByUnexpandedLocationCode(
+                        i_unexpandedLocationCode, i_nodeNumber);
+                });
             });
 
         iFace->register_method(
@@ -118,10 +153,27 @@ Manager::Manager(
             [this](const sdbusplus::message::object_path& i_dbusObjPath)
                 -> std::string { return this->getHwPath(i_dbusObjPath); });
 
+        // Recollection is asynchronous, completion is reported through the
+        // progress interface.
         iFace->register_method("PerformVPDRecollection", [this]() {
             this->performVpdRecollection();
         });
 
+        // Trace is always dumped to a fixed path, callers don't get to pick
+        // a file for the service to write.
+        iFace->register_method(
+            "DumpCollectionTrace",
+            [this](boost::asio::yield_context i_yield) -> bool {
+                return executeOnThreadPool(
+                    i_yield, [this]() { return this->dumpCollectionTrace(); });
+            });
+
+        iFace->register_method("GetMetrics", []() -> std::string {
+            return Metrics::getMetricsInstance().toJson().dump();
+        });
+
+        // Collection of all FRUs is already asynchronous, and arms a timer on
+        // the IO context.
         iFace->register_method("CollectAllFRUVPD", [this]() -> bool {
             return this->collectAllFruVpd();
         });
@@ -162,6 +214,32 @@ Manager::Manager(
             __FILE__, __FUNCTION__, 0, vpd::EventLogger::getErrorMsg(e),
             std::nullopt, std::nullopt, std::nullopt, std::nullopt);
     }
+
+#ifdef IBM_SYSTEM_SINGLE_FAB
+    // Single FAB IM override is performed as part of system bring-up by the
+    // OEM handler, as it shares the system VPD parsed there. It is performed
+    // here if the handler couldn't be created.
+    bool l_isInvalidSystemConfig = false;
+    if (m_ibmHandler.get() != nullptr)
+    {
+        l_isInvalidSystemConfig = m_ibmHandler->isInvalidSystemConfig();
+    }
+    else if (!dbusUtility::isChassisPowerOn())
+    {
+        types::VPDMapVariant l_planarVpdNotParsed;
+        SingleFab l_singleFab;
+        l_isInvalidSystemConfig =
+            (l_singleFab.singleFabImOverride(l_planarVpdNotParsed) ==
+             constants::FAILURE);
+    }
+
+    if (l_isInvalidSystemConfig)
+    {
+        throw std::runtime_error(
+            std::string(__FUNCTION__) +
+            " : Found an invalid system configuration. Needs manual intervention. BMC is being quiesced.");
+    }
+#endif
 }
 
 void Manager::readVpdCollectionMode() noexcept
@@ -193,26 +271,26 @@ void Manager::readVpdCollectionMode() noexcept
 int Manager::updateKeyword(const types::Path i_vpdPath,
                            const types::WriteVpdParams i_paramsToWriteData)
 {
+    const ScopedLatency l_latency(Histogram::UpdateKeywordLatency);
+
     if (i_vpdPath.empty())
     {
         logging::logMessage("Given VPD path is empty.");
         return -1;
     }
 
+    std::scoped_lock l_lock(m_vpdAccessMutex);
+
     uint16_t l_errCode = 0;
     types::Path l_fruPath;
-    nlohmann::json l_sysCfgJsonObj{};
+    const auto l_sysCfgJsonSnapshot = getSysCfgJsonSnapshot();
+    const nlohmann::json& l_sysCfgJsonObj = *l_sysCfgJsonSnapshot;
 
-    if (m_worker.get() != nullptr)
+    // Get the EEPROM path
+    if (!l_sysCfgJsonObj.empty())
     {
-        l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
-
-        // Get the EEPROM path
-        if (!l_sysCfgJsonObj.empty())
-        {
-            l_fruPath = jsonUtility::getFruPathFromJson(l_sysCfgJsonObj,
-                                                        i_vpdPath, l_errCode);
-        }
+        l_fruPath = jsonUtility::getFruPathFromJson(l_sysCfgJsonObj, i_vpdPath,
+                                                    l_errCode);
     }
 
     if (l_fruPath.empty())
@@ -230,7 +308,7 @@ int Manager::updateKeyword(const types::Path i_vpdPath,
     try
     {
         std::shared_ptr<Parser> l_parserObj =
-            std::make_shared<Parser>(l_fruPath, l_sysCfgJsonObj);
+            std::make_shared<Parser>(l_fruPath, l_sysCfgJsonSnapshot);
 
         types::DbusVariantType l_updatedValue;
         auto l_rc =
@@ -335,6 +413,119 @@ int Manager::updateKeyword(const types::Path i_vpdPath,
     }
 }
 
+int Manager::updateKeywords(
+    const types::Path i_vpdPath,
+    const types::ListOfWriteVpdParams i_paramsToWriteData)
+{
+    if (i_vpdPath.empty() || i_paramsToWriteData.empty())
+    {
+        logging::logMessage("Given VPD path or list of keywords is empty.");
+        return -1;
+    }
+
+    std::scoped_lock l_lock(m_vpdAccessMutex);
+
+    uint16_t l_errCode = 0;
+    types::Path l_fruPath;
+    const auto l_sysCfgJsonSnapshot = getSysCfgJsonSnapshot();
+    const nlohmann::json& l_sysCfgJsonObj = *l_sysCfgJsonSnapshot;
+
+    // Get the EEPROM path
+    if (!l_sysCfgJsonObj.empty())
+    {
+        l_fruPath = jsonUtility::getFruPathFromJson(l_sysCfgJsonObj, i_vpdPath,
+                                                    l_errCode);
+    }
+
+    if (l_fruPath.empty())
+    {
+        if (l_errCode)
+        {
+            logging::logMessage(
+                "Failed to get FRU path from JSON for [" + i_vpdPath +
+                "], error : " + commonUtility::getErrCodeMsg(l_errCode));
+        }
+
+        l_fruPath = i_vpdPath;
+    }
+
+    try
+    {
+        std::shared_ptr<Parser> l_parserObj =
+            std::make_shared<Parser>(l_fruPath, l_sysCfgJsonSnapshot);
+
+        types::ListOfWriteVpdParams l_updatedData;
+        auto l_rc =
+            l_parserObj->updateVpdKeywords(i_paramsToWriteData, l_updatedData);
+
+        if (l_rc == constants::FAILURE)
+        {
+            l_updatedData = i_paramsToWriteData;
+        }
+
+        auto l_logger = Logger::getLoggerInstance();
+
+        if (l_rc != constants::FAILURE)
+        {
+            // Sync the keywords to backup path and inherited FRUs in one go.
+            if (m_backupAndRestoreObj &&
+                m_backupAndRestoreObj->updateKeywordsOnPrimaryOrBackupPath(
+                    l_fruPath, l_updatedData) < constants::VALUE_0)
+            {
+                logging::logMessage(
+                    "Write success, but backup and restore failed for file[" +
+                    l_fruPath + "]");
+            }
+
+            // update keywords in inherited FRUs
+            vpdSpecificUtility::updateKwdOnInheritedFrus(
+                l_fruPath, l_updatedData, l_sysCfgJsonObj, l_errCode);
+
+            if (l_errCode)
+            {
+                logging::logMessage(
+                    "Failed to update keywords on inherited FRUs for FRU [" +
+                    l_fruPath + "] , error : " +
+                    commonUtility::getErrCodeMsg(l_errCode));
+            }
+
+            // update common interface(s) properties
+            vpdSpecificUtility::updateCiPropertyOfInheritedFrus(
+                l_fruPath, l_updatedData, l_sysCfgJsonObj, l_errCode);
+
+            if (l_errCode)
+            {
+                l_logger->logMessage(
+                    "Failed to update Ci property of inherited FRUs, error : " +
+                    commonUtility::getErrCodeMsg(l_errCode));
+            }
+        }
+
+        for (const auto& l_writeParams : l_updatedData)
+        {
+            l_errCode = 0;
+
+            // log VPD write success or failure
+            l_logger->logMessage(
+                "VPD write " +
+                    std::string((l_rc != constants::FAILURE) ? "successful"
+                                                             : "failed") +
+                    " on path[" + i_vpdPath + "] : " +
+                    vpdSpecificUtility::convertWriteVpdParamsToString(
+                        l_writeParams, l_errCode),
+                PlaceHolder::VPD_WRITE);
+        }
+
+        return l_rc;
+    }
+    catch (const std::exception& l_exception)
+    {
+        logging::logMessage("Update keywords failed for file[" + i_vpdPath +
+                            "], reason: " + std::string(l_exception.what()));
+        return -1;
+    }
+}
+
 int Manager::updateKeywordOnHardware(
     const types::Path i_fruPath,
     const types::WriteVpdParams i_paramsToWriteData) noexcept
@@ -346,15 +537,8 @@ int Manager::updateKeywordOnHardware(
             throw std::runtime_error("Given FRU path is empty");
         }
 
-        nlohmann::json l_sysCfgJsonObj{};
-
-        if (m_worker.get() != nullptr)
-        {
-            l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
-        }
-
         std::shared_ptr<Parser> l_parserObj =
-            std::make_shared<Parser>(i_fruPath, l_sysCfgJsonObj);
+            std::make_shared<Parser>(i_fruPath, getSysCfgJsonSnapshot());
         return l_parserObj->updateVpdKeywordOnHardware(i_paramsToWriteData);
     }
     catch (const std::exception& l_exception)
@@ -373,15 +557,10 @@ int Manager::updateKeywordOnHardware(
 types::DbusVariantType Manager::readKeyword(
     const types::Path i_fruPath, const types::ReadVpdParams i_paramsToReadData)
 {
+    const ScopedLatency l_latency(Histogram::ReadKeywordLatency);
+
     try
     {
-        nlohmann::json l_jsonObj{};
-
-        if (m_worker.get() != nullptr)
-        {
-            l_jsonObj = m_worker->getSysCfgJsonObj();
-        }
-
         std::error_code ec;
 
         // Check if given path is filesystem path
@@ -391,14 +570,12 @@ types::DbusVariantType Manager::readKeyword(
                 "Given file path " + i_fruPath + " not found.");
         }
 
-        std::shared_ptr<vpd::Parser> l_parserObj =
-            std::make_shared<vpd::Parser>(i_fruPath, l_jsonObj);
-
-        std::shared_ptr<vpd::ParserInterface> l_vpdParserInstance =
-            l_parserObj->getVpdParserInstance();
+        vpd::Parser l_parserObj(i_fruPath, getSysCfgJsonSnapshot());
 
-        return (
-            l_vpdParserInstance->readKeywordFromHardware(i_paramsToReadData));
+        return l_parserObj.executeOnCachedVpd(
+            [&i_paramsToReadData](vpd::ParserInterface& i_vpdParser) {
+                return i_vpdParser.readKeywordFromHardware(i_paramsToReadData);
+            });
     }
     catch (const std::exception& e)
     {
@@ -410,9 +587,13 @@ types::DbusVariantType Manager::readKeyword(
 }
 
 void Manager::collectSingleFruVpd(
+    boost::asio::yield_context i_yield,
     const sdbusplus::message::object_path& i_dbusObjPath)
 {
-    if (m_vpdCollectionStatus != constants::vpdCollectionCompleted)
+    // Failed status only means some FRU failed recollection, collection is
+    // over all the same.
+    if (m_vpdCollectionStatus != constants::vpdCollectionCompleted &&
+        m_vpdCollectionStatus != constants::vpdCollectionFailed)
     {
         logging::logMessage(
             "Currently VPD CollectionStatus is not completed. Cannot perform single FRU VPD collection for " +
@@ -420,10 +601,12 @@ void Manager::collectSingleFruVpd(
         return;
     }
 
-    if (m_worker.get() != nullptr)
-    {
-        m_worker->collectSingleFruVpd(i_dbusObjPath);
-    }
+    executeOnThreadPool(i_yield, [&]() {
+        if (m_worker.get() != nullptr)
+        {
+            m_worker->collectSingleFruVpd(i_dbusObjPath);
+        }
+    });
 }
 
 void Manager::deleteSingleFruVpd(
@@ -491,7 +674,8 @@ std::string Manager::getExpandedLocationCode(
         return std::string{};
     }
 
-    const nlohmann::json& l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
+    const auto l_sysCfgJsonSnapshot = m_worker->getSysCfgJsonObj();
+    const nlohmann::json& l_sysCfgJsonObj = *l_sysCfgJsonSnapshot;
     if (!l_sysCfgJsonObj.contains("frus"))
     {
         logging::logMessage("Missing frus tag in system config JSON");
@@ -543,7 +727,8 @@ types::ListOfPaths Manager::getFrusByUnexpandedLocationCode(
         return l_inventoryPaths;
     }
 
-    const nlohmann::json& l_sysCfgJsonObj = m_worker->getSysCfgJsonObj();
+    const auto l_sysCfgJsonSnapshot = m_worker->getSysCfgJsonObj();
+    const nlohmann::json& l_sysCfgJsonObj = *l_sysCfgJsonSnapshot;
     if (!l_sysCfgJsonObj.contains("frus"))
     {
         logging::logMessage("Missing frus tag in system config JSON");
@@ -720,10 +905,68 @@ types::ListOfPaths Manager::getFrusByExpandedLocationCode(
 
 void Manager::performVpdRecollection()
 {
-    if (m_worker.get() != nullptr)
+    if (m_worker.get() == nullptr)
+    {
+        m_logger->logMessage(
+            "Worker object not found, can't perform VPD recollection.");
+        return;
+    }
+
+    if (m_vpdCollectionStatus == constants::vpdCollectionInProgress)
+    {
+        m_logger->logMessage(
+            "VPD collection is in progress, skipping VPD recollection.");
+        return;
+    }
+
+    const std::string l_collectionStatus{m_vpdCollectionStatus};
+    m_progressInterface->set_property(
+        "Status", std::string(constants::vpdCollectionInProgress));
+    Tracer::getTracerInstance().startTrace();
+
+    const bool l_isRecollectionStarted =
+        m_worker->performVpdRecollection(
+            [this](const std::vector<std::string>& i_failedEeproms) {
+                Tracer::getTracerInstance().stopTrace();
+
+                for (const auto& l_eepromPath : i_failedEeproms)
+                {
+                    m_logger->logMessage(
+                        "VPD recollection failed for [" + l_eepromPath + "]");
+                }
+
+                // Status reflects if any FRU failed recollection. Progress of
+                // a FRU's retry is reflected in its own collection status.
+                const std::string l_status =
+                    i_failedEeproms.empty() ? constants::vpdCollectionCompleted
+                                            : constants::vpdCollectionFailed;
+
+                // Called from a collection thread, update the progress
+                // interface from the event loop.
+                boost::asio::post(*m_ioContext, [this, l_status]() {
+                    m_progressInterface->set_property("Status", l_status);
+                });
+            });
+
+    if (!l_isRecollectionStarted)
+    {
+        Tracer::getTracerInstance().stopTrace();
+        m_progressInterface->set_property("Status", l_collectionStatus);
+    }
+}
+
+bool Manager::dumpCollectionTrace() const noexcept
+{
+    if (!Tracer::getTracerInstance().dumpChromeTrace(
+            constants::collectionTraceFilePath))
     {
-        m_worker->performVpdRecollection();
+        return false;
     }
+
+    m_logger->logMessage("Collection trace dumped to [" +
+                         std::string(constants::collectionTraceFilePath) +
+                         "]");
+    return true;
 }
 
 bool Manager::collectAllFruVpd() const noexcept
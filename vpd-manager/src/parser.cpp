@@ -8,11 +8,17 @@
 #include <utility/vpd_specific_utility.hpp>
 
 #include <fstream>
+#include <future>
 
 namespace vpd
 {
-Parser::Parser(const std::string& vpdFilePath, nlohmann::json parsedJson) :
-    m_vpdFilePath(vpdFilePath), m_parsedJson(parsedJson)
+Parser::Parser(const std::string& vpdFilePath,
+               std::shared_ptr<const nlohmann::json> i_sysCfgJsonObj) :
+    m_vpdFilePath(vpdFilePath),
+    m_sysCfgJsonObj(i_sysCfgJsonObj
+                        ? std::move(i_sysCfgJsonObj)
+                        : std::make_shared<const nlohmann::json>()),
+    m_parsedJson(*m_sysCfgJsonObj)
 {
     std::error_code l_errCode;
 
@@ -37,7 +43,7 @@ Parser::Parser(const std::string& vpdFilePath, nlohmann::json parsedJson) :
         uint16_t l_errorCode = 0;
 
         m_vpdStartOffset =
-            jsonUtility::getVPDOffset(m_parsedJson, vpdFilePath, l_errorCode);
+            jsonUtility::getVPDOffset(m_parsedJson, m_vpdFilePath, l_errorCode);
 
         if (l_errorCode)
         {
@@ -46,8 +52,24 @@ Parser::Parser(const std::string& vpdFilePath, nlohmann::json parsedJson) :
                 "], error: " + commonUtility::getErrCodeMsg(l_errorCode));
         }
     }
+
+    uint16_t l_errorCode = 0;
+    m_writePageSize = vpdSpecificUtility::getEepromWritePageSize(
+        m_parsedJson, m_vpdFilePath, l_errorCode);
+
+    if (l_errorCode)
+    {
+        logging::logMessage("Failed to get write page size of [" +
+                            m_vpdFilePath + "], error : " +
+                            commonUtility::getErrCodeMsg(l_errorCode));
+    }
 }
 
+Parser::Parser(const std::string& vpdFilePath,
+               const nlohmann::json& parsedJson) :
+    Parser(vpdFilePath, std::make_shared<const nlohmann::json>(parsedJson))
+{}
+
 std::shared_ptr<vpd::ParserInterface> Parser::getVpdParserInstance()
 {
     // Read the VPD data into a vector.
@@ -62,8 +84,8 @@ std::shared_ptr<vpd::ParserInterface> Parser::getVpdParserInstance()
     }
 
     // This will detect the type of parser required.
-    std::shared_ptr<vpd::ParserInterface> l_parser =
-        ParserFactory::getParser(m_vpdVector, m_vpdFilePath, m_vpdStartOffset);
+    std::shared_ptr<vpd::ParserInterface> l_parser = ParserFactory::getParser(
+        m_vpdVector, m_vpdFilePath, m_vpdStartOffset, m_writePageSize);
 
     return l_parser;
 }
@@ -77,68 +99,91 @@ types::VPDMapVariant Parser::parse()
 int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData,
                              types::DbusVariantType& o_updatedValue)
 {
-    int l_bytesUpdatedOnHardware = constants::FAILURE;
-
-    // A lambda to extract Record : Keyword string from i_paramsToWriteData
-    auto l_keyWordIdentifier =
-        [](const types::WriteVpdParams& i_paramsToWriteData) -> std::string {
-        std::string l_keywordString{};
+    // A single keyword update is a list update of one keyword, so that it gets
+    // the same ordering of hardware and D-Bus updates and the same revert.
+    types::ListOfWriteVpdParams l_updatedData;
+    const int l_bytesUpdatedOnHardware =
+        updateVpdKeywords({i_paramsToWriteData}, l_updatedData);
+
+    if (l_bytesUpdatedOnHardware != constants::FAILURE &&
+        !l_updatedData.empty())
+    {
         if (const types::IpzData* l_ipzData =
-                std::get_if<types::IpzData>(&i_paramsToWriteData))
+                std::get_if<types::IpzData>(&l_updatedData.front()))
         {
-            l_keywordString =
-                std::get<0>(*l_ipzData) + ":" + std::get<1>(*l_ipzData);
+            o_updatedValue = std::get<2>(*l_ipzData);
         }
         else if (const types::KwData* l_kwData =
-                     std::get_if<types::KwData>(&i_paramsToWriteData))
+                     std::get_if<types::KwData>(&l_updatedData.front()))
         {
-            l_keywordString = std::get<0>(*l_kwData);
+            o_updatedValue = std::get<1>(*l_kwData);
         }
-        return l_keywordString;
-    };
+    }
 
-    try
-    {
-        // Enable Reboot Guard
-        if (constants::FAILURE == dbusUtility::EnableRebootGuard())
-        {
-            EventLogger::createAsyncPel(
-                types::ErrorType::DbusFailure,
-                types::SeverityType::Informational, __FILE__, __FUNCTION__, 0,
-                std::string(
-                    "Failed to enable BMC Reboot Guard while updating " +
-                    l_keyWordIdentifier(i_paramsToWriteData)),
-                std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+    return l_bytesUpdatedOnHardware;
+}
 
-            return constants::FAILURE;
-        }
+int Parser::updateVpdKeywords(
+    const types::ListOfWriteVpdParams& i_paramsToWriteData,
+    types::ListOfWriteVpdParams& o_updatedData)
+{
+    int l_bytesUpdatedOnHardware = constants::FAILURE;
 
-        // Update keyword's value on hardware
-        try
+    // A lambda to extract list of Record : Keyword string from
+    // i_paramsToWriteData
+    auto l_keyWordsIdentifier =
+        [](const types::ListOfWriteVpdParams& i_paramsToWriteData)
+        -> std::string {
+        std::string l_keywordsString{};
+        for (const auto& l_paramsToWrite : i_paramsToWriteData)
         {
-            std::shared_ptr<ParserInterface> l_vpdParserInstance =
-                getVpdParserInstance();
-            l_bytesUpdatedOnHardware =
-                l_vpdParserInstance->writeKeywordOnHardware(
-                    i_paramsToWriteData);
+            if (!l_keywordsString.empty())
+            {
+                l_keywordsString += ", ";
+            }
+
+            if (const types::IpzData* l_ipzData =
+                    std::get_if<types::IpzData>(&l_paramsToWrite))
+            {
+                l_keywordsString +=
+                    std::get<0>(*l_ipzData) + ":" + std::get<1>(*l_ipzData);
+            }
+            else if (const types::KwData* l_kwData =
+                         std::get_if<types::KwData>(&l_paramsToWrite))
+            {
+                l_keywordsString += std::get<0>(*l_kwData);
+            }
         }
-        catch (const std::exception& l_exception)
-        {
-            std::string l_errMsg(
-                "Error while updating keyword's value on hardware path " +
-                m_vpdFilePath + ", error: " + std::string(l_exception.what()));
+        return l_keywordsString;
+    };
 
-            // TODO : Log PEL
+    // Enable Reboot Guard
+    if (constants::FAILURE == dbusUtility::EnableRebootGuard())
+    {
+        EventLogger::createAsyncPel(
+            types::ErrorType::DbusFailure, types::SeverityType::Informational,
+            __FILE__, __FUNCTION__, 0,
+            std::string("Failed to enable BMC Reboot Guard while updating " +
+                        l_keyWordsIdentifier(i_paramsToWriteData)),
+            std::nullopt, std::nullopt, std::nullopt, std::nullopt);
 
-            throw std::runtime_error(l_errMsg);
-        }
+        return constants::FAILURE;
+    }
 
+    try
+    {
         uint16_t l_errCode = 0;
 
-        auto [l_fruPath, l_inventoryObjPath, l_redundantFruPath] =
+        auto [l_fruPath, l_inventoryObjPath, l_redundantPath] =
             jsonUtility::getAllPathsToUpdateKeyword(m_parsedJson, m_vpdFilePath,
                                                     l_errCode);
 
+        if (l_errCode == error_code::ERROR_GETTING_REDUNDANT_PATH)
+        {
+            logging::logMessage(commonUtility::getErrCodeMsg(l_errCode));
+            l_errCode = 0;
+        }
+
         if (l_errCode == error_code::INVALID_INPUT_PARAMETER ||
             l_errCode == error_code::INVALID_JSON)
         {
@@ -147,115 +192,90 @@ int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData,
                 commonUtility::getErrCodeMsg(l_errCode));
         }
 
-        // If inventory D-bus object path is present, update keyword's value on
-        // DBus
-        if (!l_inventoryObjPath.empty())
-        {
-            types::Record l_recordName;
-            std::string l_interfaceName;
-            std::string l_propertyName;
-            types::DbusVariantType l_keywordValue;
+        // Primary and redundant EEPROMs sit on different buses, update
+        // keywords' value on redundant hardware in parallel.
+        const std::string l_redundantFruPath{l_redundantPath};
+        types::ListOfWriteVpdParams l_previousDataOnRedundantPath;
+        std::future<int> l_redundantPathUpdate;
 
-            if (const types::IpzData* l_ipzData =
-                    std::get_if<types::IpzData>(&i_paramsToWriteData))
-            {
-                l_recordName = std::get<0>(*l_ipzData);
-                l_interfaceName = constants::ipzVpdInf + l_recordName;
-                l_propertyName = std::get<1>(*l_ipzData);
-
-                try
-                {
-                    // Read keyword's value from hardware to write the same on
-                    // D-bus.
-                    std::shared_ptr<ParserInterface> l_vpdParserInstance =
-                        getVpdParserInstance();
-
-                    l_keywordValue =
-                        l_vpdParserInstance->readKeywordFromHardware(
-                            types::ReadVpdParams(
-                                std::make_tuple(l_recordName, l_propertyName)));
-
-                    // return the actual value updated on hardware
-                    o_updatedValue = l_keywordValue;
-                }
-                catch (const std::exception& l_exception)
-                {
-                    // Unable to read keyword's value from hardware.
-                    std::string l_errMsg(
-                        "Error while reading keyword's value from hadware path " +
-                        m_vpdFilePath +
-                        ", error: " + std::string(l_exception.what()));
-
-                    // TODO: Log PEL
-
-                    throw std::runtime_error(l_errMsg);
-                }
-            }
-            else
-            {
-                // Input parameter type provided isn't compatible to perform
-                // update.
-                std::string l_errMsg(
-                    "Input parameter type isn't compatible to update keyword's value on DBus for object path: " +
-                    l_inventoryObjPath);
-                throw std::runtime_error(l_errMsg);
-            }
+        if (!l_redundantFruPath.empty())
+        {
+            l_redundantPathUpdate = std::async(std::launch::async, [&]() {
+                return updateVpdKeywordsOnRedundantPath(
+                    l_redundantFruPath, i_paramsToWriteData,
+                    l_previousDataOnRedundantPath);
+            });
+        }
 
-            // Get D-bus name for the given keyword
-            l_propertyName = vpdSpecificUtility::getDbusPropNameForGivenKw(
-                l_propertyName, l_errCode);
+        // Update all the keywords' value on hardware in one go, keeping their
+        // value before the update to be able to revert it.
+        types::ListOfWriteVpdParams l_previousData;
+        try
+        {
+            l_bytesUpdatedOnHardware =
+                executeOnCachedVpd([this, &i_paramsToWriteData,
+                                    &l_previousData](
+                                       ParserInterface& i_vpdParser) {
+                    return writeVpdKeywordsKeepingPreviousData(
+                        m_vpdFilePath, i_vpdParser, i_paramsToWriteData,
+                        l_previousData);
+                });
+        }
+        catch (const std::exception& l_exception)
+        {
+            syncRedundantPathUpdate(l_redundantFruPath, l_redundantPathUpdate,
+                                    l_previousDataOnRedundantPath, false);
 
-            if (l_errCode)
-            {
-                logging::logMessage(
-                    "Failed to get Dbus property name for given keyword, error : " +
-                    commonUtility::getErrCodeMsg(l_errCode));
-            }
+            throw std::runtime_error(
+                "Error while updating keywords' value on hardware path " +
+                m_vpdFilePath + ", error: " + std::string(l_exception.what()));
+        }
 
-            // Create D-bus object map
-            types::ObjectMap l_dbusObjMap = {std::make_pair(
-                l_inventoryObjPath,
-                types::InterfaceMap{std::make_pair(
-                    l_interfaceName, types::PropertyMap{std::make_pair(
-                                         l_propertyName, l_keywordValue)})})};
+        if (l_bytesUpdatedOnHardware == constants::FAILURE)
+        {
+            syncRedundantPathUpdate(l_redundantFruPath, l_redundantPathUpdate,
+                                    l_previousDataOnRedundantPath, false);
 
-            // Call method to update on dbus
-            if (!dbusUtility::publishVpdOnDBus(std::move(l_dbusObjMap)))
-            {
-                // Update to dbus failed.
-                std::string l_errMsg(
-                    "publishVpdOnDBus is failed for object path: " +
-                    l_inventoryObjPath);
-                throw std::runtime_error(l_errMsg);
-            }
+            throw std::runtime_error(
+                "Keywords update not supported for the VPD type of " +
+                m_vpdFilePath);
         }
 
-        if (l_errCode == error_code::ERROR_GETTING_REDUNDANT_PATH)
+        // Both the EEPROMs are updated before publishing the keywords.
+        if (l_redundantPathUpdate.valid() &&
+            (l_redundantPathUpdate.get() == constants::FAILURE))
         {
-            logging::logMessage(commonUtility::getErrCodeMsg(l_errCode));
+            revertVpdKeywords(l_previousData, std::string{}, {});
+
+            throw std::runtime_error(
+                "Error while updating keywords' value on redundant path " +
+                l_redundantFruPath);
         }
 
-        // Update keyword's value on redundant hardware if present
-        if (!l_redundantFruPath.empty())
+        // By default, the updated value is the one requested.
+        o_updatedData = i_paramsToWriteData;
+
+        // If inventory D-bus object path is present, update all the keywords'
+        // value on DBus with a single call.
+        if (!l_inventoryObjPath.empty())
         {
-            if (updateVpdKeywordOnRedundantPath(l_redundantFruPath,
-                                                i_paramsToWriteData) < 0)
+            try
+            {
+                publishVpdKeywords(l_inventoryObjPath, o_updatedData);
+            }
+            catch (const std::exception& l_exception)
             {
-                std::string l_errMsg(
-                    "Error while updating keyword's value on redundant path " +
-                    l_redundantFruPath);
-                throw std::runtime_error(l_errMsg);
+                revertVpdKeywords(l_previousData, l_redundantFruPath,
+                                  l_previousDataOnRedundantPath);
+                throw;
             }
         }
-
-        // TODO: Check if revert is required when any of the writes fails.
-        // TODO: Handle error logging
     }
     catch (const std::exception& l_ex)
     {
-        logging::logMessage("Update VPD Keyword failed for : " +
-                            l_keyWordIdentifier(i_paramsToWriteData) +
-                            " failed due to error: " + l_ex.what());
+        logging::logMessage("Update VPD Keywords failed for : [" +
+                            l_keyWordsIdentifier(i_paramsToWriteData) +
+                            "] due to error: " + l_ex.what());
 
         // update failed, set return value to failure
         l_bytesUpdatedOnHardware = constants::FAILURE;
@@ -268,32 +288,224 @@ int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData,
             types::ErrorType::DbusFailure, types::SeverityType::Critical,
             __FILE__, __FUNCTION__, 0,
             std::string("Failed to disable BMC Reboot Guard while updating " +
-                        l_keyWordIdentifier(i_paramsToWriteData)),
+                        l_keyWordsIdentifier(i_paramsToWriteData)),
             std::nullopt, std::nullopt, std::nullopt, std::nullopt);
     }
 
     return l_bytesUpdatedOnHardware;
 }
 
+void Parser::publishVpdKeywords(
+    const std::string& i_inventoryObjPath,
+    types::ListOfWriteVpdParams& io_updatedData)
+{
+    uint16_t l_errCode = 0;
+    types::InterfaceMap l_interfaceMap;
+
+    // Read the updated keywords' value from the cached VPD, which holds the
+    // bytes verified on hardware by read back, to publish them on D-bus.
+    for (auto& l_updatedData : io_updatedData)
+    {
+        types::IpzData* l_ipzData = std::get_if<types::IpzData>(&l_updatedData);
+
+        if (l_ipzData == nullptr)
+        {
+            throw std::runtime_error(
+                "Input parameter type isn't compatible to update keyword's value on DBus for object path: " +
+                i_inventoryObjPath);
+        }
+
+        auto& [l_recordName, l_keywordName, l_keywordValue] = *l_ipzData;
+
+        types::DbusVariantType l_readValue;
+        try
+        {
+            l_readValue = executeOnCachedVpd(
+                [&l_recordName, &l_keywordName](ParserInterface& i_vpdParser) {
+                    return i_vpdParser.readKeywordFromHardware(
+                        types::ReadVpdParams(
+                            std::make_tuple(l_recordName, l_keywordName)));
+                });
+        }
+        catch (const std::exception& l_exception)
+        {
+            throw std::runtime_error(
+                "Error while reading keyword's value from cached VPD of " +
+                m_vpdFilePath + ", error: " + std::string(l_exception.what()));
+        }
+
+        if (const types::BinaryVector* l_value =
+                std::get_if<types::BinaryVector>(&l_readValue))
+        {
+            l_keywordValue = *l_value;
+        }
+
+        // Get D-bus name for the given keyword
+        const std::string l_propertyName =
+            vpdSpecificUtility::getDbusPropNameForGivenKw(l_keywordName,
+                                                          l_errCode);
+
+        if (l_errCode)
+        {
+            logging::logMessage(
+                "Failed to get Dbus property name for given keyword, error : " +
+                commonUtility::getErrCodeMsg(l_errCode));
+            l_errCode = 0;
+        }
+
+        l_interfaceMap[constants::ipzVpdInf + l_recordName][l_propertyName] =
+            l_readValue;
+    }
+
+    types::ObjectMap l_dbusObjMap = {
+        std::make_pair(i_inventoryObjPath, std::move(l_interfaceMap))};
+
+    if (!dbusUtility::publishVpdOnDBus(std::move(l_dbusObjMap)))
+    {
+        throw std::runtime_error(
+            "publishVpdOnDBus is failed for object path: " +
+            i_inventoryObjPath);
+    }
+}
+
+void Parser::revertVpdKeywords(
+    const types::ListOfWriteVpdParams& i_previousData,
+    const std::string& i_redundantFruPath,
+    const types::ListOfWriteVpdParams& i_previousDataOnRedundantPath) noexcept
+{
+    bool l_isReverted = !i_previousData.empty();
+
+    if (l_isReverted)
+    {
+        try
+        {
+            l_isReverted =
+                (executeOnCachedVpd([&i_previousData](
+                                        ParserInterface& i_vpdParser) {
+                     return (i_previousData.size() == constants::VALUE_1)
+                                ? i_vpdParser.writeKeywordOnHardware(
+                                      i_previousData.front())
+                                : i_vpdParser.writeKeywordsOnHardware(
+                                      i_previousData);
+                 }) != constants::FAILURE);
+        }
+        catch (const std::exception& l_exception)
+        {
+            l_isReverted = false;
+        }
+    }
+
+    if (!i_redundantFruPath.empty())
+    {
+        types::ListOfWriteVpdParams l_dataBeforeRevert;
+        l_isReverted = l_isReverted && !i_previousDataOnRedundantPath.empty() &&
+                       (updateVpdKeywordsOnRedundantPath(
+                            i_redundantFruPath, i_previousDataOnRedundantPath,
+                            l_dataBeforeRevert) != constants::FAILURE);
+    }
+
+    const std::string l_paths =
+        m_vpdFilePath + (i_redundantFruPath.empty()
+                             ? std::string{}
+                             : " and redundant path " + i_redundantFruPath);
+
+    if (l_isReverted)
+    {
+        logging::logMessage("Reverted keywords' update on path " + l_paths);
+        return;
+    }
+
+    EventLogger::createSyncPel(
+        types::ErrorType::InvalidVpdMessage, types::SeverityType::Informational,
+        __FILE__, __FUNCTION__, 0,
+        "Failed to revert keywords' update on path " + l_paths +
+            ", VPD on hardware and D-Bus may be out of sync.",
+        std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+}
+
+int Parser::writeVpdKeywordsKeepingPreviousData(
+    const std::string& i_fruPath, ParserInterface& i_vpdParser,
+    const types::ListOfWriteVpdParams& i_paramsToWriteData,
+    types::ListOfWriteVpdParams& o_previousData)
+{
+    o_previousData.clear();
+
+    try
+    {
+        for (const auto& l_paramsToWrite : i_paramsToWriteData)
+        {
+            if (const types::IpzData* l_ipzData =
+                    std::get_if<types::IpzData>(&l_paramsToWrite))
+            {
+                const auto l_value = i_vpdParser.readKeywordFromHardware(
+                    types::ReadVpdParams(std::make_tuple(
+                        std::get<0>(*l_ipzData), std::get<1>(*l_ipzData))));
+
+                if (const auto l_binaryValue =
+                        std::get_if<types::BinaryVector>(&l_value))
+                {
+                    o_previousData.emplace_back(types::IpzData(
+                        std::get<0>(*l_ipzData), std::get<1>(*l_ipzData),
+                        *l_binaryValue));
+                }
+            }
+            else if (const types::KwData* l_kwData =
+                         std::get_if<types::KwData>(&l_paramsToWrite))
+            {
+                const auto l_value = i_vpdParser.readKeywordFromHardware(
+                    types::ReadVpdParams(std::get<0>(*l_kwData)));
+
+                if (const auto l_binaryValue =
+                        std::get_if<types::BinaryVector>(&l_value))
+                {
+                    o_previousData.emplace_back(
+                        types::KwData(std::get<0>(*l_kwData), *l_binaryValue));
+                }
+            }
+        }
+    }
+    catch (const std::exception& l_exception)
+    {
+        logging::logMessage("Failed to read keywords' value from path " +
+                            i_fruPath +
+                            ", error: " + std::string(l_exception.what()));
+    }
+
+    if (o_previousData.size() != i_paramsToWriteData.size())
+    {
+        // Can't revert partially.
+        o_previousData.clear();
+    }
+
+    return (i_paramsToWriteData.size() == constants::VALUE_1)
+               ? i_vpdParser.writeKeywordOnHardware(i_paramsToWriteData.front())
+               : i_vpdParser.writeKeywordsOnHardware(i_paramsToWriteData);
+}
+
 int Parser::updateVpdKeyword(const types::WriteVpdParams& i_paramsToWriteData)
 {
     types::DbusVariantType o_updatedValue;
     return updateVpdKeyword(i_paramsToWriteData, o_updatedValue);
 }
 
-int Parser::updateVpdKeywordOnRedundantPath(
+int Parser::updateVpdKeywordsOnRedundantPath(
     const std::string& i_fruPath,
-    const types::WriteVpdParams& i_paramsToWriteData)
+    const types::ListOfWriteVpdParams& i_paramsToWriteData,
+    types::ListOfWriteVpdParams& o_previousData)
 {
+    o_previousData.clear();
+
     try
     {
-        std::shared_ptr<Parser> l_parserObj =
-            std::make_shared<Parser>(i_fruPath, m_parsedJson);
-
-        std::shared_ptr<ParserInterface> l_vpdParserInstance =
-            l_parserObj->getVpdParserInstance();
-
-        return l_vpdParserInstance->writeKeywordOnHardware(i_paramsToWriteData);
+        Parser l_parserObj(i_fruPath, m_sysCfgJsonObj);
+
+        return l_parserObj.executeOnCachedVpd(
+            [&i_fruPath, &i_paramsToWriteData,
+             &o_previousData](ParserInterface& i_vpdParser) {
+                return writeVpdKeywordsKeepingPreviousData(
+                    i_fruPath, i_vpdParser, i_paramsToWriteData,
+                    o_previousData);
+            });
     }
     catch (const std::exception& l_exception)
     {
@@ -303,8 +515,56 @@ int Parser::updateVpdKeywordOnRedundantPath(
             "Error while updating keyword's value on redundant path " +
                 i_fruPath + ", error: " + std::string(l_exception.what()),
             std::nullopt, std::nullopt, std::nullopt, std::nullopt);
-        return -1;
+        return constants::FAILURE;
+    }
+}
+
+bool Parser::syncRedundantPathUpdate(
+    const std::string& i_redundantFruPath,
+    std::future<int>& io_redundantPathUpdate,
+    const types::ListOfWriteVpdParams& i_previousData,
+    bool i_isPrimaryPathUpdated)
+{
+    if (!io_redundantPathUpdate.valid())
+    {
+        // No redundant path to update.
+        return true;
     }
+
+    const bool l_isRedundantPathUpdated =
+        (io_redundantPathUpdate.get() != constants::FAILURE);
+
+    if (i_isPrimaryPathUpdated == l_isRedundantPathUpdated)
+    {
+        return l_isRedundantPathUpdated;
+    }
+
+    if (l_isRedundantPathUpdated)
+    {
+        // Primary path holds the old value, revert the redundant path.
+        types::ListOfWriteVpdParams l_dataBeforeRevert;
+        if (!i_previousData.empty() &&
+            updateVpdKeywordsOnRedundantPath(i_redundantFruPath, i_previousData,
+                                             l_dataBeforeRevert) !=
+                constants::FAILURE)
+        {
+            logging::logMessage(
+                "Update failed on primary path " + m_vpdFilePath +
+                ", reverted update on redundant path " + i_redundantFruPath);
+            return true;
+        }
+    }
+
+    EventLogger::createSyncPel(
+        types::ErrorType::InvalidVpdMessage, types::SeverityType::Informational,
+        __FILE__, __FUNCTION__, 0,
+        "Primary path " + m_vpdFilePath + " and redundant path " +
+            i_redundantFruPath + " are out of sync, update " +
+            (i_isPrimaryPathUpdated ? "failed" : "succeeded") +
+            " only on redundant path.",
+        std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+
+    return l_isRedundantPathUpdated;
 }
 
 int Parser::updateVpdKeywordOnHardware(
@@ -346,10 +606,10 @@ int Parser::updateVpdKeywordOnHardware(
             return constants::FAILURE;
         }
 
-        std::shared_ptr<ParserInterface> l_vpdParserInstance =
-            getVpdParserInstance();
-        l_bytesUpdatedOnHardware =
-            l_vpdParserInstance->writeKeywordOnHardware(i_paramsToWriteData);
+        l_bytesUpdatedOnHardware = executeOnCachedVpd(
+            [&i_paramsToWriteData](ParserInterface& i_vpdParser) {
+                return i_vpdParser.writeKeywordOnHardware(i_paramsToWriteData);
+            });
     }
     catch (const std::exception& l_exception)
     {
@@ -95,8 +95,8 @@ static vpdType vpdTypeCheck(const types::BinaryVector& i_vpdVector)
 }
 
 std::shared_ptr<ParserInterface> ParserFactory::getParser(
-    const types::BinaryVector& i_vpdVector, const std::string& i_vpdFilePath,
-    size_t i_vpdStartOffset)
+    types::BinaryVector& i_vpdVector, const std::string& i_vpdFilePath,
+    size_t i_vpdStartOffset, size_t i_writePageSize)
 {
     if (i_vpdVector.empty())
     {
@@ -110,8 +110,8 @@ std::shared_ptr<ParserInterface> ParserFactory::getParser(
     {
         case vpdType::IPZ_VPD:
         {
-            return std::make_shared<IpzVpdParser>(i_vpdVector, i_vpdFilePath,
-                                                  i_vpdStartOffset);
+            return std::make_shared<IpzVpdParser>(
+                i_vpdVector, i_vpdFilePath, i_vpdStartOffset, i_writePageSize);
         }
 
         case vpdType::KEYWORD_VPD:
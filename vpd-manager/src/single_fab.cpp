@@ -62,25 +62,52 @@ std::string SingleFab::getImFromPersistedLocation() const noexcept
     return std::string();
 }
 
-std::string SingleFab::getImFromPlanar() const noexcept
+std::string SingleFab::getImFromPlanar(
+    const types::VPDMapVariant& i_parsedPlanarVpd) const noexcept
 {
     try
     {
-        const std::string l_systemPlanarPath(SYSTEM_VPD_FILE_PATH);
-        Parser l_parserObj(l_systemPlanarPath, nlohmann::json{});
+        types::BinaryVector l_imValue;
+
+        if (const auto l_ipzVpdMap =
+                std::get_if<types::IPZVpdMap>(&i_parsedPlanarVpd))
+        {
+            // Planar VPD is already parsed, no need to read the EEPROM.
+            if (const auto l_itrToVsbp = l_ipzVpdMap->find(constants::recVSBP);
+                l_itrToVsbp != l_ipzVpdMap->end())
+            {
+                if (const auto l_itrToIm =
+                        l_itrToVsbp->second.find(constants::kwdIM);
+                    l_itrToIm != l_itrToVsbp->second.end())
+                {
+                    l_imValue.assign(l_itrToIm->second.begin(),
+                                     l_itrToIm->second.end());
+                }
+            }
+        }
+        else
+        {
+            const std::string l_systemPlanarPath(SYSTEM_VPD_FILE_PATH);
+            const nlohmann::json l_parsedJson{};
+            Parser l_parserObj(l_systemPlanarPath, l_parsedJson);
+
+            std::shared_ptr<ParserInterface> l_vpdParserInstance =
+                l_parserObj.getVpdParserInstance();
 
-        std::shared_ptr<ParserInterface> l_vpdParserInstance =
-            l_parserObj.getVpdParserInstance();
+            auto l_readValue = l_vpdParserInstance->readKeywordFromHardware(
+                std::make_tuple(constants::recVSBP, constants::kwdIM));
 
-        auto l_readValue = l_vpdParserInstance->readKeywordFromHardware(
-            std::make_tuple(constants::recVSBP, constants::kwdIM));
+            if (auto l_keywordValue =
+                    std::get_if<types::BinaryVector>(&l_readValue))
+            {
+                l_imValue = std::move(*l_keywordValue);
+            }
+        }
 
-        if (auto l_keywordValue =
-                std::get_if<types::BinaryVector>(&l_readValue);
-            l_keywordValue && !l_keywordValue->empty())
+        if (!l_imValue.empty())
         {
             std::ostringstream l_imData;
-            for (const auto& l_byte : *l_keywordValue)
+            for (const auto& l_byte : l_imValue)
             {
                 l_imData << std::setw(2) << std::setfill('0') << std::hex
                          << static_cast<int>(l_byte);
@@ -95,7 +122,9 @@ std::string SingleFab::getImFromPlanar() const noexcept
     return std::string();
 }
 
-bool SingleFab::setImOnPlanar(const std::string& i_imValue) const noexcept
+bool SingleFab::setImOnPlanar(
+    const std::string& i_imValue,
+    types::VPDMapVariant& io_parsedPlanarVpd) const noexcept
 {
     try
     {
@@ -110,13 +139,28 @@ bool SingleFab::setImOnPlanar(const std::string& i_imValue) const noexcept
                 static_cast<uint8_t>(std::stoi(l_byteString, nullptr, 16)));
         }
 
-        std::shared_ptr<Parser> l_parserObj = std::make_shared<Parser>(
-            l_systemPlanarEepromPath, nlohmann::json{});
+        const nlohmann::json l_parsedJson{};
+        std::shared_ptr<Parser> l_parserObj =
+            std::make_shared<Parser>(l_systemPlanarEepromPath, l_parsedJson);
 
         int l_bytes_updated = l_parserObj->updateVpdKeywordOnHardware(
             std::make_tuple(constants::recVSBP, constants::kwdIM, l_imValue));
 
-        return l_bytes_updated > 0 ? true : false;
+        if (l_bytes_updated <= 0)
+        {
+            return false;
+        }
+
+        // Keep parsed planar VPD in sync with the value on hardware.
+        if (auto l_ipzVpdMap =
+                std::get_if<types::IPZVpdMap>(&io_parsedPlanarVpd);
+            l_ipzVpdMap && l_ipzVpdMap->contains(constants::recVSBP))
+        {
+            (*l_ipzVpdMap)[constants::recVSBP][constants::kwdIM] =
+                std::string(l_imValue.begin(), l_imValue.end());
+        }
+
+        return true;
     }
     catch (const std::exception& l_ex)
     {
@@ -125,7 +169,8 @@ bool SingleFab::setImOnPlanar(const std::string& i_imValue) const noexcept
 }
 
 void SingleFab::updateSystemImValueInVpdToP11Series(
-    std::string i_currentImValuePlanar) const noexcept
+    std::string i_currentImValuePlanar,
+    types::VPDMapVariant& io_parsedPlanarVpd) const noexcept
 {
     bool l_retVal{false};
     if (!i_currentImValuePlanar.empty())
@@ -142,9 +187,11 @@ void SingleFab::updateSystemImValueInVpdToP11Series(
 
         // update the IM value to P11 series(6000x). Replace the first character
         // of IM value string with '6'
-        l_retVal = setImOnPlanar(i_currentImValuePlanar.replace(
-            constants::VALUE_0, constants::VALUE_1,
-            std::to_string(constants::VALUE_6)));
+        l_retVal = setImOnPlanar(
+            i_currentImValuePlanar.replace(constants::VALUE_0,
+                                           constants::VALUE_1,
+                                           std::to_string(constants::VALUE_6)),
+            io_parsedPlanarVpd);
     }
 
     if (!l_retVal)
@@ -157,10 +204,11 @@ void SingleFab::updateSystemImValueInVpdToP11Series(
     }
 }
 
-int SingleFab::singleFabImOverride() const noexcept
+int SingleFab::singleFabImOverride(
+    types::VPDMapVariant& io_parsedPlanarVpd) const noexcept
 {
     uint16_t l_errCode = 0;
-    const std::string& l_planarImValue = getImFromPlanar();
+    const std::string& l_planarImValue = getImFromPlanar(io_parsedPlanarVpd);
     const std::string& l_eBmcImValue = getImFromPersistedLocation();
     const bool& l_isFieldModeEnabled =
         commonUtility::isFieldModeEnabled(l_errCode);
@@ -252,7 +300,8 @@ int SingleFab::singleFabImOverride() const noexcept
             {
                 if (isP10System(l_planarImValue))
                 {
-                    updateSystemImValueInVpdToP11Series(l_planarImValue);
+                    updateSystemImValueInVpdToP11Series(l_planarImValue,
+                                                        io_parsedPlanarVpd);
                 }
             }
         }
@@ -290,7 +339,8 @@ int SingleFab::singleFabImOverride() const noexcept
             }
             else
             {
-                updateSystemImValueInVpdToP11Series(l_planarImValue);
+                updateSystemImValueInVpdToP11Series(l_planarImValue,
+                                                    io_parsedPlanarVpd);
             }
         }
     }
@@ -0,0 +1,167 @@
+#include "tracer.hpp"
+
+#include "logger.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <unistd.h>
+
+#include <fstream>
+
+namespace vpd
+{
+namespace
+{
+/**
+ * @brief API to copy a string to fixed size storage, truncating if required.
+ *
+ * @param[in] i_source - String to copy.
+ * @param[out] o_destination - Storage, null terminated after the copy.
+ */
+template <size_t N>
+void copyTruncated(std::string_view i_source,
+                   std::array<char, N>& o_destination) noexcept
+{
+    const size_t l_length = i_source.copy(o_destination.data(), N - 1);
+    o_destination[l_length] = '\0';
+}
+} // namespace
+
+void Tracer::startTrace() noexcept
+{
+    std::scoped_lock l_lock(m_mutex);
+    m_startTime = std::chrono::steady_clock::now();
+    m_firstSpanIndex = m_spanCount.load(std::memory_order_relaxed);
+    m_isEnabled.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::recordSpan(
+    std::string_view i_name, std::string_view i_context,
+    std::chrono::steady_clock::time_point i_startTime,
+    std::chrono::steady_clock::time_point i_endTime) noexcept
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    // Buffer is circular, the oldest span is overwritten once it is full.
+    const size_t l_spanIndex =
+        m_spanCount.fetch_add(1, std::memory_order_relaxed);
+    Span& l_span = m_spans[l_spanIndex % MAX_SPANS];
+
+    // Sequence number is cleared before and set after the span is written,
+    // so that a dump reading the slot meanwhile can detect it.
+    l_span.m_sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    copyTruncated(i_name, l_span.m_name);
+    copyTruncated(i_context, l_span.m_context);
+    l_span.m_startTime = i_startTime;
+    l_span.m_endTime = i_endTime;
+    l_span.m_threadId = static_cast<int>(::gettid());
+
+    l_span.m_sequence.store(l_spanIndex + 1, std::memory_order_release);
+}
+
+bool Tracer::dumpChromeTrace(const std::string& i_filePath) const noexcept
+{
+    try
+    {
+        nlohmann::json l_traceEvents = nlohmann::json::array();
+        size_t l_droppedSpanCount = 0;
+        {
+            std::scoped_lock l_lock(m_mutex);
+
+            const size_t l_spanCount =
+                m_spanCount.load(std::memory_order_acquire);
+
+            // Spans are dumped oldest first.
+            size_t l_firstSpanIndex = m_firstSpanIndex;
+            if (l_spanCount - l_firstSpanIndex > MAX_SPANS)
+            {
+                l_droppedSpanCount = l_spanCount - l_firstSpanIndex - MAX_SPANS;
+                l_firstSpanIndex = l_spanCount - MAX_SPANS;
+            }
+
+            for (size_t l_spanIndex = l_firstSpanIndex;
+                 l_spanIndex < l_spanCount; ++l_spanIndex)
+            {
+                const Span& l_slot = m_spans[l_spanIndex % MAX_SPANS];
+
+                // Copy the slot, and take the copy only if the slot held this
+                // span all through the copy.
+                if (l_slot.m_sequence.load(std::memory_order_acquire) !=
+                    l_spanIndex + 1)
+                {
+                    ++l_droppedSpanCount;
+                    continue;
+                }
+
+                const auto l_name = l_slot.m_name;
+                const auto l_context = l_slot.m_context;
+                const auto l_startTime = l_slot.m_startTime;
+                const auto l_endTime = l_slot.m_endTime;
+                const int l_threadId = l_slot.m_threadId;
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (l_slot.m_sequence.load(std::memory_order_relaxed) !=
+                    l_spanIndex + 1)
+                {
+                    ++l_droppedSpanCount;
+                    continue;
+                }
+
+                const auto l_startTimeUs =
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        l_startTime - m_startTime)
+                        .count();
+                const auto l_durationUs =
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        l_endTime - l_startTime)
+                        .count();
+
+                nlohmann::json l_event{{"name", l_name.data()},
+                                       {"cat", "vpd"},
+                                       {"ph", "X"},
+                                       {"ts", l_startTimeUs},
+                                       {"dur", l_durationUs},
+                                       {"pid", ::getpid()},
+                                       {"tid", l_threadId}};
+
+                if (l_context.front() != '\0')
+                {
+                    l_event["args"] = {{"context", l_context.data()}};
+                }
+
+                l_traceEvents.push_back(std::move(l_event));
+            }
+        }
+
+        std::ofstream l_traceFile(i_filePath, std::ios::out | std::ios::trunc);
+        if (!l_traceFile.is_open())
+        {
+            logging::logMessage("Failed to open trace file [" + i_filePath +
+                                "]");
+            return false;
+        }
+
+        l_traceFile << nlohmann::json{{"traceEvents", l_traceEvents},
+                                      {"displayTimeUnit", "ms"}};
+
+        if (l_droppedSpanCount != 0)
+        {
+            logging::logMessage(std::to_string(l_droppedSpanCount) +
+                                " span(s) overwritten or being written, not "
+                                "dumped.");
+        }
+        return true;
+    }
+    catch (const std::exception& l_ex)
+    {
+        logging::logMessage("Failed to dump trace to [" + i_filePath +
+                            "], error : " + l_ex.what());
+    }
+    return false;
+}
+} // namespace vpd
@@ -5,9 +5,12 @@
 #include "backup_restore.hpp"
 #include "constants.hpp"
 #include "exceptions.hpp"
+#include "metrics.hpp"
 #include "parser.hpp"
 #include "parser_factory.hpp"
 #include "parser_interface.hpp"
+#include "tracer.hpp"
+#include "vpd_cache.hpp"
 
 #include <utility/common_utility.hpp>
 #include <utility/dbus_utility.hpp>
@@ -15,34 +18,31 @@
 #include <utility/json_utility.hpp>
 #include <utility/vpd_specific_utility.hpp>
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <future>
+#include <map>
 #include <typeindex>
 #include <unordered_set>
+#include <utility>
 
 namespace vpd
 {
 
 Worker::Worker(std::string pathToConfigJson, uint8_t i_maxThreadCount,
-               types::VpdCollectionMode i_vpdCollectionMode) :
-    m_configJsonPath(pathToConfigJson), m_semaphore(i_maxThreadCount),
+               types::VpdCollectionMode i_vpdCollectionMode,
+               std::shared_ptr<const nlohmann::json> i_sysCfgJsonObj) :
+    m_configJsonPath(pathToConfigJson),
+    m_sysCfgJsonObj(getSysCfgJson(m_configJsonPath, i_sysCfgJsonObj)),
+    m_parsedJson(*m_sysCfgJsonObj), m_ioStageThreadCount(i_maxThreadCount),
     m_vpdCollectionMode(i_vpdCollectionMode),
     m_logger(Logger::getLoggerInstance())
 {
     // Implies the processing is based on some config JSON
     if (!m_configJsonPath.empty())
     {
-        uint16_t l_errCode = 0;
-        m_parsedJson = jsonUtility::getParsedJson(m_configJsonPath, l_errCode);
-
-        if (l_errCode)
-        {
-            throw JsonException("JSON parsing failed. error : " +
-                                    commonUtility::getErrCodeMsg(l_errCode),
-                                m_configJsonPath);
-        }
-
         // check for mandatory fields at this point itself.
         if (!m_parsedJson.contains("frus"))
         {
@@ -54,6 +54,39 @@ Worker::Worker(std::string pathToConfigJson, uint8_t i_maxThreadCount,
     {
         logging::logMessage("Processing in not based on any config JSON");
     }
+
+    m_ioScheduler = std::make_shared<IoScheduler>(m_parsedJson);
+
+    // EEPROM I/O for keyword read and write is scheduled along with the I/O
+    // of collection.
+    VpdCache::getVpdCacheInstance().setIoScheduler(m_ioScheduler);
+}
+
+std::shared_ptr<const nlohmann::json> Worker::getSysCfgJson(
+    const std::string& i_configJsonPath,
+    std::shared_ptr<const nlohmann::json> i_sysCfgJsonObj)
+{
+    if (i_sysCfgJsonObj)
+    {
+        return i_sysCfgJsonObj;
+    }
+
+    if (i_configJsonPath.empty())
+    {
+        return std::make_shared<const nlohmann::json>();
+    }
+
+    uint16_t l_errCode = 0;
+    auto l_parsedJson = jsonUtility::getParsedJson(i_configJsonPath, l_errCode);
+
+    if (l_errCode)
+    {
+        throw JsonException("JSON parsing failed. error : " +
+                                commonUtility::getErrCodeMsg(l_errCode),
+                            i_configJsonPath);
+    }
+
+    return std::make_shared<const nlohmann::json>(std::move(l_parsedJson));
 }
 
 void Worker::populateIPZVPDpropertyMap(
@@ -520,24 +553,12 @@ void Worker::processFunctionalProperty(const std::string& i_inventoryObjPath,
 {
     if (!dbusUtility::isChassisPowerOn())
     {
-        std::vector<std::string> l_operationalStatusInf = {
-            constants::operationalStatusInf};
-
-        auto mapperObjectMap = dbusUtility::getObjectMap(
-            i_inventoryObjPath, l_operationalStatusInf);
-
-        // If the object has been found. Check if it is under PIM.
-        if (mapperObjectMap.size() != 0)
+        if (dbusUtility::isHostedByPim(i_inventoryObjPath,
+                                       constants::operationalStatusInf))
         {
-            for (const auto& [l_serviceName, l_interfaceLsit] : mapperObjectMap)
-            {
-                if (l_serviceName == constants::pimServiceName)
-                {
-                    // The object is already under PIM. No need to process
-                    // again. Retain the old value.
-                    return;
-                }
-            }
+            // The object is already under PIM. No need to process again.
+            // Retain the old value.
+            return;
         }
 
         // Implies value is not there in D-Bus. Populate it with default
@@ -567,23 +588,12 @@ void Worker::processEnabledProperty(const std::string& i_inventoryObjPath,
 {
     if (!dbusUtility::isChassisPowerOn())
     {
-        std::vector<std::string> l_enableInf = {constants::enableInf};
-
-        auto mapperObjectMap =
-            dbusUtility::getObjectMap(i_inventoryObjPath, l_enableInf);
-
-        // If the object has been found. Check if it is under PIM.
-        if (mapperObjectMap.size() != 0)
+        if (dbusUtility::isHostedByPim(i_inventoryObjPath,
+                                       constants::enableInf))
         {
-            for (const auto& [l_serviceName, l_interfaceLsit] : mapperObjectMap)
-            {
-                if (l_serviceName == constants::pimServiceName)
-                {
-                    // The object is already under PIM. No need to process
-                    // again. Retain the old value.
-                    return;
-                }
-            }
+            // The object is already under PIM. No need to process again.
+            // Retain the old value.
+            return;
         }
 
         // Implies value is not there in D-Bus. Populate it with default
@@ -620,7 +630,7 @@ void Worker::populateDbus(const types::VPDMapVariant& parsedVpdMap,
 
     // JSON config is mandatory for processing of "if". Add "else" for any
     // processing without config JSON.
-    if (!m_parsedJson.empty())
+    if (!m_parsedJson.empty() && m_parsedJson["frus"].contains(vpdFilePath))
     {
         types::InterfaceMap interfaces;
 
@@ -690,9 +700,9 @@ bool Worker::processPreAction(const std::string& i_vpdFilePath,
         // data section in case any FRU is not present or there is any
         // problem in collecting it. Once it has been deleted, it can be
         // re-created in the flow of priming the inventory. This needs to be
-        // done either here or in the exception section of "parseAndPublishVPD"
-        // API. Any failure in the process of collecting FRU will land up in the
-        // excpetion of "parseAndPublishVPD".
+        // done either here or in "onFruCollectionFailure" API. Any failure in
+        // the process of collecting FRU will land up in
+        // "onFruCollectionFailure".
 
         // If the FRU is not there, clear the VINI/CCIN data.
         // Enity manager probes for this keyword to look for this
@@ -700,8 +710,8 @@ bool Worker::processPreAction(const std::string& i_vpdFilePath,
         // removed this can lead to ambiguity. Hence clearing this
         // Keyword if FRU is absent.
         const auto& inventoryPath =
-            m_parsedJson["frus"][i_vpdFilePath].at(0).value("inventoryPath",
-                                                            "");
+            m_parsedJson.at("frus").at(i_vpdFilePath).at(0).value(
+                "inventoryPath", "");
 
         if (!inventoryPath.empty())
         {
@@ -790,291 +800,677 @@ bool Worker::processPostAction(
     return true;
 }
 
-types::VPDMapVariant Worker::parseVpdFile(const std::string& i_vpdFilePath)
+bool Worker::readVpdForCollection(const std::string& i_vpdFilePath,
+                                  types::BinaryVector& o_vpdVector,
+                                  size_t& o_vpdStartOffset)
 {
-    try
+    uint16_t l_errCode = 0;
+
+    if (i_vpdFilePath.empty())
     {
-        uint16_t l_errCode = 0;
+        throw std::runtime_error(
+            std::string(__FUNCTION__) +
+            " Empty VPD file path passed. Abort processing");
+    }
 
-        if (i_vpdFilePath.empty())
+    // VPD is read afresh, drop the VPD cached for keyword read and write.
+    VpdCache::getVpdCacheInstance().invalidate(i_vpdFilePath);
+
+    bool isPreActionRequired = false;
+    if (jsonUtility::isActionRequired(m_parsedJson, i_vpdFilePath, "preAction",
+                                      "collection", l_errCode))
+    {
+        isPreActionRequired = true;
+
+        bool l_isPreActionDone = false;
         {
-            throw std::runtime_error(
-                std::string(__FUNCTION__) +
-                " Empty VPD file path passed. Abort processing");
+            const TraceSpan l_span("PreAction", i_vpdFilePath);
+            l_isPreActionDone =
+                processPreAction(i_vpdFilePath, "collection", l_errCode);
         }
 
-        bool isPreActionRequired = false;
-        if (jsonUtility::isActionRequired(m_parsedJson, i_vpdFilePath,
-                                          "preAction", "collection", l_errCode))
+        if (!l_isPreActionDone)
         {
-            isPreActionRequired = true;
-            if (!processPreAction(i_vpdFilePath, "collection", l_errCode))
+            if (l_errCode == error_code::DEVICE_NOT_PRESENT)
             {
-                if (l_errCode == error_code::DEVICE_NOT_PRESENT)
-                {
-                    logging::logMessage(
-                        commonUtility::getErrCodeMsg(l_errCode) +
-                        i_vpdFilePath);
+                logging::logMessage(
+                    commonUtility::getErrCodeMsg(l_errCode) + i_vpdFilePath);
 
-                    // since pre action is reporting device not present, execute
-                    // post fail action
-                    checkAndExecutePostFailAction(i_vpdFilePath, "collection");
+                // since pre action is reporting device not present, execute
+                // post fail action
+                checkAndExecutePostFailAction(i_vpdFilePath, "collection");
 
-                    // Presence pin has been read successfully and has been read
-                    // as false, so this is not a failure case, hence returning
-                    // empty variant so that pre action is not marked as failed.
-                    return types::VPDMapVariant{};
-                }
-                throw std::runtime_error(
-                    std::string(__FUNCTION__) +
-                    " Pre-Action failed with error: " +
-                    commonUtility::getErrCodeMsg(l_errCode));
+                // Presence pin has been read successfully and has been read
+                // as false, so this is not a failure case, hence returning
+                // without VPD so that pre action is not marked as failed.
+                return false;
             }
+            throw std::runtime_error(
+                std::string(__FUNCTION__) + " Pre-Action failed with error: " +
+                commonUtility::getErrCodeMsg(l_errCode));
         }
-        else if (l_errCode)
+    }
+    else if (l_errCode)
+    {
+        logging::logMessage(
+            "Failed to check if pre action required for FRU [" +
+            i_vpdFilePath +
+            "], error : " + commonUtility::getErrCodeMsg(l_errCode));
+    }
+
+    if (!std::filesystem::exists(i_vpdFilePath))
+    {
+        if (isPreActionRequired)
         {
-            logging::logMessage(
-                "Failed to check if pre action required for FRU [" +
-                i_vpdFilePath +
-                "], error : " + commonUtility::getErrCodeMsg(l_errCode));
+            throw std::runtime_error(
+                std::string(__FUNCTION__) + " Could not find file path " +
+                i_vpdFilePath + "Skipping parser trigger for the EEPROM");
         }
+        return false;
+    }
+
+    o_vpdStartOffset = 0;
+    if (!m_parsedJson.empty())
+    {
+        o_vpdStartOffset =
+            jsonUtility::getVPDOffset(m_parsedJson, i_vpdFilePath, l_errCode);
 
-        if (!std::filesystem::exists(i_vpdFilePath))
+        if (l_errCode)
         {
-            if (isPreActionRequired)
-            {
-                throw std::runtime_error(
-                    std::string(__FUNCTION__) + " Could not find file path " +
-                    i_vpdFilePath + "Skipping parser trigger for the EEPROM");
-            }
-            return types::VPDMapVariant{};
+            logging::logMessage(
+                "Failed to get vpd offset for path [" + i_vpdFilePath +
+                "], error: " + commonUtility::getErrCodeMsg(l_errCode));
         }
+    }
+
+    const auto l_readTimeout = jsonUtility::getEepromReadTimeout(
+        m_parsedJson, i_vpdFilePath, l_errCode);
 
-        std::shared_ptr<Parser> vpdParser =
-            std::make_shared<Parser>(i_vpdFilePath, m_parsedJson);
+    if (l_errCode)
+    {
+        logging::logMessage(
+            "Failed to get read timeout for path [" + i_vpdFilePath +
+            "], error: " + commonUtility::getErrCodeMsg(l_errCode));
+    }
 
-        types::VPDMapVariant l_parsedVpd = vpdParser->parse();
+    // Each abandoned read may still be blocked, holding a thread and an open
+    // file.
+    if (m_ioScheduler->getAbandonedIoCount() >=
+        constants::MAX_ABANDONED_EEPROM_READS)
+    {
+        throw std::runtime_error("VPD read on [" + i_vpdFilePath +
+                                 "] not started, too many reads abandoned.");
+    }
 
-        // Before returning, as collection is over, check if FRU qualifies for
-        // any post action in the flow of collection.
-        // Note: Don't change the order, post action needs to be processed only
-        // after collection for FRU is successfully done.
-        if (jsonUtility::isActionRequired(m_parsedJson, i_vpdFilePath,
-                                          "postAction", "collection",
-                                          l_errCode))
+    const std::string l_busId = m_ioScheduler->getBusId(i_vpdFilePath);
+    {
+        // Hold a slot on the EEPROM's bus till the read returns, even if it
+        // is abandoned, so that I/O on the bus stays serialized. Slot is not
+        // given on a bus with an abandoned read, till the read returns.
+        std::shared_ptr<IoScheduler::IoSlot> l_ioSlot;
         {
-            if (!processPostAction(i_vpdFilePath, "collection", l_parsedVpd))
-            {
-                // Post action was required but failed while executing.
-                // Behaviour can be undefined.
-                EventLogger::createSyncPel(
-                    types::ErrorType::InternalFailure,
-                    types::SeverityType::Warning, __FILE__, __FUNCTION__, 0,
-                    std::string("Required post action failed for path [" +
-                                i_vpdFilePath + "]"),
-                    std::nullopt, std::nullopt, std::nullopt, std::nullopt);
-            }
+            const TraceSpan l_span("IoSlotWait", i_vpdFilePath);
+            l_ioSlot = m_ioScheduler->acquireIoSlot(i_vpdFilePath);
         }
-        else if (l_errCode)
+
+        auto l_onReadOver = [l_ioSlot]() mutable { l_ioSlot.reset(); };
+
         {
-            logging::logMessage(
-                "Error while checking if post action required for FRU [" +
-                i_vpdFilePath +
-                "], error : " + commonUtility::getErrCodeMsg(l_errCode));
+            const TraceSpan l_span("EepromRead", i_vpdFilePath);
+            vpdSpecificUtility::getVpdDataInVectorWithTimeout(
+                i_vpdFilePath, o_vpdVector, o_vpdStartOffset, l_readTimeout,
+                std::move(l_onReadOver), l_errCode);
         }
 
-        return l_parsedVpd;
+        if (l_errCode == error_code::EEPROM_READ_TIMEOUT)
+        {
+            // Reader thread releases the slot once the read returns.
+            l_ioSlot->abandon();
+        }
     }
-    catch (std::exception& l_ex)
+
+    Metrics& l_metrics = Metrics::getMetricsInstance();
+    l_metrics.increment(Counter::EepromReads);
+    l_metrics.increment(Counter::EepromBytesRead, o_vpdVector.size());
+    l_metrics.incrementBusReads(l_busId);
+
+    if (l_errCode == error_code::EEPROM_READ_TIMEOUT)
     {
-        std::string l_exMsg{
-            std::string(__FUNCTION__) + " : VPD parsing failed for " +
-            i_vpdFilePath + " due to error: " + l_ex.what()};
+        l_metrics.increment(Counter::EepromReadTimeouts);
+        throw std::runtime_error(
+            "VPD read on [" + i_vpdFilePath + "] not over in " +
+            std::to_string(l_readTimeout.count()) + "ms, abandoned.");
+    }
 
-        // If post fail action is required, execute it.
-        checkAndExecutePostFailAction(i_vpdFilePath, "collection");
+    if (l_errCode)
+    {
+        // Partially read VPD is not parsed, failure is reported as read
+        // failure and not as bad VPD.
+        l_metrics.increment(Counter::EepromReadFailures);
+        throw std::runtime_error("Failed to get VPD in vector for path [" +
+                                 i_vpdFilePath + "], error : " +
+                                 commonUtility::getErrCodeMsg(l_errCode));
+    }
 
-        if (typeid(l_ex) == typeid(DataException))
+    return true;
+}
+
+types::VPDMapVariant Worker::parseVpdForCollection(
+    const std::string& i_vpdFilePath, types::BinaryVector& i_vpdVector,
+    size_t i_vpdStartOffset)
+{
+    uint16_t l_errCode = 0;
+
+    types::VPDMapVariant l_parsedVpd;
+    {
+        const TraceSpan l_span("Parse", i_vpdFilePath);
+        l_parsedVpd = ParserFactory::getParser(i_vpdVector, i_vpdFilePath,
+                                               i_vpdStartOffset)
+                          ->parse();
+    }
+
+    // Before returning, as collection is over, check if FRU qualifies for
+    // any post action in the flow of collection.
+    // Note: Don't change the order, post action needs to be processed only
+    // after collection for FRU is successfully done.
+    if (jsonUtility::isActionRequired(m_parsedJson, i_vpdFilePath,
+                                      "postAction", "collection", l_errCode))
+    {
+        bool l_isPostActionDone = false;
         {
-            throw DataException(l_exMsg);
+            const TraceSpan l_span("PostAction", i_vpdFilePath);
+            l_isPostActionDone =
+                processPostAction(i_vpdFilePath, "collection", l_parsedVpd);
         }
-        else if (typeid(l_ex) == typeid(EccException))
+
+        if (!l_isPostActionDone)
         {
-            throw EccException(l_exMsg);
+            // Post action was required but failed while executing.
+            // Behaviour can be undefined.
+            EventLogger::createSyncPel(
+                types::ErrorType::InternalFailure,
+                types::SeverityType::Warning, __FILE__, __FUNCTION__, 0,
+                std::string("Required post action failed for path [" +
+                            i_vpdFilePath + "]"),
+                std::nullopt, std::nullopt, std::nullopt, std::nullopt);
         }
-        throw std::runtime_error(l_exMsg);
     }
+    else if (l_errCode)
+    {
+        logging::logMessage(
+            "Error while checking if post action required for FRU [" +
+            i_vpdFilePath +
+            "], error : " + commonUtility::getErrCodeMsg(l_errCode));
+    }
+
+    return l_parsedVpd;
 }
 
-std::tuple<bool, std::string> Worker::parseAndPublishVPD(
-    const std::string& i_vpdFilePath)
+void Worker::throwParsingFailure(const std::string& i_vpdFilePath,
+                                 const std::exception& i_ex) const
+{
+    std::string l_exMsg{"VPD parsing failed for " + i_vpdFilePath +
+                        " due to error: " + i_ex.what()};
+
+    if (typeid(i_ex) == typeid(DataException))
+    {
+        throw DataException(l_exMsg);
+    }
+    else if (typeid(i_ex) == typeid(EccException))
+    {
+        throw EccException(l_exMsg);
+    }
+    throw std::runtime_error(l_exMsg);
+}
+
+types::VPDMapVariant Worker::parseVpdFile(const std::string& i_vpdFilePath)
 {
-    std::string l_inventoryPath{};
-    uint16_t l_errCode = 0;
     try
     {
-        m_semaphore.acquire();
+        types::BinaryVector l_vpdVector;
+        size_t l_vpdStartOffset = 0;
 
-        // Thread launched.
-        m_mutex.lock();
-        m_activeCollectionThreadCount++;
-        m_mutex.unlock();
+        if (!readVpdForCollection(i_vpdFilePath, l_vpdVector,
+                                  l_vpdStartOffset))
+        {
+            return types::VPDMapVariant{};
+        }
+
+        return parseVpdForCollection(i_vpdFilePath, l_vpdVector,
+                                     l_vpdStartOffset);
+    }
+    catch (const std::exception& l_ex)
+    {
+        // If post fail action is required, execute it.
+        checkAndExecutePostFailAction(i_vpdFilePath, "collection");
+        throwParsingFailure(i_vpdFilePath, l_ex);
+    }
+}
+
+void Worker::onFruCollectionSuccess(const std::string& i_vpdFilePath,
+                                    bool i_isVpdEmpty)
+{
+    uint16_t l_errCode = 0;
+
+    if (i_isVpdEmpty)
+    {
+        // Stale data from the previous boot can be present on the system.
+        // so clearing of data incase of empty map received.
+        // As empty parsedVpdMap recieved for some reason, but still
+        // considered VPD collection is completed. Hence FRU collection
+        // Status will be set as completed.
+
+        vpdSpecificUtility::resetObjTreeVpd(i_vpdFilePath, m_parsedJson,
+                                            l_errCode);
 
-        vpdSpecificUtility::setCollectionStatusProperty(
-            i_vpdFilePath, types::VpdCollectionStatus::InProgress, m_parsedJson,
-            l_errCode);
         if (l_errCode)
         {
             m_logger->logMessage(
-                "Failed to set collection status for path " + i_vpdFilePath +
-                "Reason: " + commonUtility::getErrCodeMsg(l_errCode));
+                "Failed to reset data under PIM for path [" + i_vpdFilePath +
+                "], error : " + commonUtility::getErrCodeMsg(l_errCode));
         }
 
-        const types::VPDMapVariant& parsedVpdMap = parseVpdFile(i_vpdFilePath);
-        if (!std::holds_alternative<std::monostate>(parsedVpdMap))
+        m_logger->logMessage("Empty parsedVpdMap recieved for path [" +
+                                 i_vpdFilePath + "]. Check PEL for reason.",
+                             PlaceHolder::COLLECTION);
+    }
+
+    vpdSpecificUtility::setCollectionStatusProperty(
+        i_vpdFilePath, types::VpdCollectionStatus::Completed, m_parsedJson,
+        l_errCode);
+
+    if (l_errCode)
+    {
+        m_logger->logMessage(
+            "Failed to set collection status as completed for path " +
+            i_vpdFilePath +
+            "Reason: " + commonUtility::getErrCodeMsg(l_errCode));
+    }
+
+    Metrics::getMetricsInstance().increment(Counter::FrusCollected);
+
+    std::scoped_lock l_lock(m_mutex);
+    m_fruCollectionRetryCount.erase(i_vpdFilePath);
+    m_activeCollectionThreadCount--;
+}
+
+void Worker::onFruCollectionFailure(const std::string& i_vpdFilePath,
+                                    const std::exception& i_ex)
+{
+    bool l_isRetryPending = false;
+    {
+        // Failure to read, like an I2C error, can be transient. VPD failing to
+        // parse is retried only once, in case it got garbled on the bus.
+        const uint8_t l_maxRetries =
+            ((typeid(i_ex) == typeid(DataException)) ||
+             (typeid(i_ex) == typeid(EccException)))
+                ? constants::FRU_COLLECTION_MAX_DATA_ERROR_RETRIES
+                : constants::FRU_COLLECTION_MAX_RETRIES;
+
+        std::scoped_lock l_lock(m_mutex);
+
+        if (m_eepromsUnderRecollection.erase(i_vpdFilePath) != 0)
         {
-            types::ObjectMap objectInterfaceMap;
-            populateDbus(parsedVpdMap, objectInterfaceMap, i_vpdFilePath);
+            m_failedRecollectionEeproms.push_back(i_vpdFilePath);
+        }
 
-            // Call dbus method to update on dbus
-            if (!dbusUtility::publishVpdOnDBus(move(objectInterfaceMap)))
-            {
-                throw std::runtime_error(
-                    std::string(__FUNCTION__) +
-                    "Call to PIM failed while publishing VPD.");
-            }
+        l_isRetryPending = m_onFruCollectionRetryPending &&
+                           (m_fruCollectionRetryCount[i_vpdFilePath] <
+                            l_maxRetries);
+
+        if (l_isRetryPending)
+        {
+            m_failedEepromPaths.push_front(i_vpdFilePath);
+            m_activeCollectionThreadCount--;
         }
         else
         {
-            // Stale data from the previous boot can be present on the system.
-            // so clearing of data incase of empty map received.
-            // As empty parsedVpdMap recieved for some reason, but still
-            // considered VPD collection is completed. Hence FRU collection
-            // Status will be set as completed.
+            m_fruCollectionRetryCount.erase(i_vpdFilePath);
+        }
+    }
 
-            vpdSpecificUtility::resetObjTreeVpd(i_vpdFilePath, m_parsedJson,
-                                                l_errCode);
+    if (l_isRetryPending)
+    {
+        // Failure is handled once retries are exhausted, FRU's data is left
+        // as is till then.
+        m_logger->logMessage("VPD collection of [" + i_vpdFilePath +
+                                 "] failed, to be retried. Error: " +
+                                 std::string(i_ex.what()),
+                             PlaceHolder::COLLECTION);
+        return;
+    }
 
-            if (l_errCode)
+    // Retries are exhausted, if post fail action is required, execute it.
+    checkAndExecutePostFailAction(i_vpdFilePath, "collection");
+
+    uint16_t l_errCode = 0;
+
+    // stale data can be present on the system from previous boot. so
+    // clearing of data in case of failure.
+    vpdSpecificUtility::resetObjTreeVpd(i_vpdFilePath, m_parsedJson,
+                                        l_errCode);
+
+    if (l_errCode)
+    {
+        m_logger->logMessage(
+            "Failed to reset under PIM for path [" + i_vpdFilePath +
+            "], error : " + commonUtility::getErrCodeMsg(l_errCode));
+    }
+
+    vpdSpecificUtility::setCollectionStatusProperty(
+        i_vpdFilePath, types::VpdCollectionStatus::Failed, m_parsedJson,
+        l_errCode);
+    if (l_errCode)
+    {
+        m_logger->logMessage(
+            "Failed to set collection status as failed for path " +
+            i_vpdFilePath +
+            "Reason: " + commonUtility::getErrCodeMsg(l_errCode));
+    }
+
+    bool l_isPelRequired = true;
+    if (typeid(i_ex) == std::type_index(typeid(DataException)))
+    {
+        // In case of pass1 planar, VPD can be corrupted on PCIe cards. Skip
+        // logging error for these cases.
+        if (vpdSpecificUtility::isPass1Planar(l_errCode))
+        {
+            std::string l_invPath = jsonUtility::getInventoryObjPathFromJson(
+                m_parsedJson, i_vpdFilePath, l_errCode);
+
+            if (l_errCode != 0)
             {
                 m_logger->logMessage(
-                    "Failed to reset data under PIM for path [" +
-                    i_vpdFilePath +
-                    "], error : " + commonUtility::getErrCodeMsg(l_errCode));
+                    "Failed to get inventory object path from JSON for FRU [" +
+                        i_vpdFilePath +
+                        "], error: " + commonUtility::getErrCodeMsg(l_errCode),
+                    PlaceHolder::COLLECTION);
             }
 
-            m_logger->logMessage("Empty parsedVpdMap recieved for path [" +
-                                     i_vpdFilePath + "]. Check PEL for reason.",
-                                 PlaceHolder::COLLECTION);
-        }
-
-        vpdSpecificUtility::setCollectionStatusProperty(
-            i_vpdFilePath, types::VpdCollectionStatus::Completed, m_parsedJson,
-            l_errCode);
+            const std::string& l_invPathLeafValue =
+                sdbusplus::message::object_path(l_invPath).filename();
 
-        if (l_errCode)
+            // skip logging any PEL for PCIe cards on pass 1 planar.
+            l_isPelRequired =
+                (l_invPathLeafValue.find("pcie_card", 0) == std::string::npos);
+        }
+        else if (l_errCode)
         {
             m_logger->logMessage(
-                "Failed to set collection status as completed for path " +
-                i_vpdFilePath +
-                "Reason: " + commonUtility::getErrCodeMsg(l_errCode));
+                "Failed to check if system is Pass 1 Planar, error : " +
+                    commonUtility::getErrCodeMsg(l_errCode),
+                PlaceHolder::COLLECTION);
         }
-
-        m_semaphore.release();
-        return std::make_tuple(true, i_vpdFilePath);
     }
-    catch (const std::exception& ex)
+
+    if (l_isPelRequired)
     {
-        uint16_t l_errCode = 0;
+        EventLogger::createSyncPel(
+            EventLogger::getErrorType(i_ex),
+            (typeid(i_ex) == typeid(DataException)) ||
+                    (typeid(i_ex) == typeid(EccException))
+                ? types::SeverityType::Warning
+                : types::SeverityType::Informational,
+            __FILE__, __FUNCTION__, 0, EventLogger::getErrorMsg(i_ex),
+            std::nullopt, std::nullopt, std::nullopt, std::nullopt);
 
-        // stale data can be present on the system from previous boot. so
-        // clearing of data in case of failure.
-        vpdSpecificUtility::resetObjTreeVpd(i_vpdFilePath, m_parsedJson,
-                                            l_errCode);
+        // TODO: Figure out a way to clear data in case of any failure at
+        // runtime.
 
-        if (l_errCode)
+        // set present property to false for any error case. In future this
+        // will be replaced by presence logic.
+        // Update Present property for this FRU only if we handle Present
+        // property for the FRU.
+        if (isPresentPropertyHandlingRequired(
+                m_parsedJson.at("frus").at(i_vpdFilePath).at(0)))
         {
-            m_logger->logMessage(
-                "Failed to reset under PIM for path [" + i_vpdFilePath +
-                "], error : " + commonUtility::getErrCodeMsg(l_errCode));
+            setPresentProperty(i_vpdFilePath, false);
         }
+    }
 
+    Metrics::getMetricsInstance().increment(Counter::FrusCollectionFailed);
+
+    std::scoped_lock l_lock(m_mutex);
+    m_activeCollectionThreadCount--;
+}
+
+void Worker::onFruCollectionDropped(const std::string& i_vpdFilePath)
+{
+    std::scoped_lock l_lock(m_mutex);
+
+    // add vpdFilePath(EEPROM path) to failed list
+    m_failedEepromPaths.push_front(i_vpdFilePath);
+    m_activeCollectionThreadCount--;
+}
+
+void Worker::runCollectionIoStage(
+    BoundedQueue<std::string>& i_eepromQueue,
+    BoundedQueue<types::EepromVpdData>& o_parseQueue)
+{
+    while (auto l_vpdFilePath = i_eepromQueue.pop())
+    {
+        uint16_t l_errCode = 0;
         vpdSpecificUtility::setCollectionStatusProperty(
-            i_vpdFilePath, types::VpdCollectionStatus::Failed, m_parsedJson,
-            l_errCode);
+            *l_vpdFilePath, types::VpdCollectionStatus::InProgress,
+            m_parsedJson, l_errCode);
         if (l_errCode)
         {
             m_logger->logMessage(
-                "Failed to set collection status as failed for path " +
-                i_vpdFilePath +
+                "Failed to set collection status for path " + *l_vpdFilePath +
                 "Reason: " + commonUtility::getErrCodeMsg(l_errCode));
         }
 
-        // handle all the exceptions internally. Return only true/false
-        // based on status of execution.
-        if (typeid(ex) == std::type_index(typeid(DataException)))
+        try
         {
-            // In case of pass1 planar, VPD can be corrupted on PCIe cards. Skip
-            // logging error for these cases.
-            if (vpdSpecificUtility::isPass1Planar(l_errCode))
-            {
-                std::string l_invPath =
-                    jsonUtility::getInventoryObjPathFromJson(
-                        m_parsedJson, i_vpdFilePath, l_errCode);
+            types::BinaryVector l_vpdVector;
+            size_t l_vpdStartOffset = 0;
 
-                if (l_errCode != 0)
+            try
+            {
+                // EEPROM is not read while its keywords are being written.
+                std::shared_lock l_vpdAccessLock(getVpdAccessMutex());
+                if (!readVpdForCollection(*l_vpdFilePath, l_vpdVector,
+                                          l_vpdStartOffset))
                 {
-                    m_logger->logMessage(
-                        "Failed to get inventory object path from JSON for FRU [" +
-                            i_vpdFilePath + "], error: " +
-                            commonUtility::getErrCodeMsg(l_errCode),
-                        PlaceHolder::COLLECTION);
+                    l_vpdAccessLock.unlock();
+                    onFruCollectionSuccess(*l_vpdFilePath, true);
+                    continue;
                 }
+            }
+            catch (const std::exception& l_ex)
+            {
+                throwParsingFailure(*l_vpdFilePath, l_ex);
+            }
+
+            if (!o_parseQueue.push(std::make_tuple(
+                    *l_vpdFilePath, std::move(l_vpdVector), l_vpdStartOffset)))
+            {
+                onFruCollectionDropped(*l_vpdFilePath);
+            }
+        }
+        catch (const std::exception& l_ex)
+        {
+            onFruCollectionFailure(*l_vpdFilePath, l_ex);
+        }
+    }
+}
 
-                const std::string& l_invPathLeafValue =
-                    sdbusplus::message::object_path(l_invPath).filename();
+void Worker::runCollectionParseStage(
+    BoundedQueue<types::EepromVpdData>& i_parseQueue,
+    BoundedQueue<types::EepromObjectMap>& o_publishQueue)
+{
+    while (auto l_vpdData = i_parseQueue.pop())
+    {
+        auto& [l_vpdFilePath, l_vpdVector, l_vpdStartOffset] = *l_vpdData;
 
-                if ((l_invPathLeafValue.find("pcie_card", 0) !=
-                     std::string::npos))
-                {
-                    // skip logging any PEL for PCIe cards on pass 1 planar.
-                    return std::make_tuple(false, i_vpdFilePath);
-                }
+        try
+        {
+            types::VPDMapVariant l_parsedVpdMap;
+            try
+            {
+                l_parsedVpdMap = parseVpdForCollection(
+                    l_vpdFilePath, l_vpdVector, l_vpdStartOffset);
             }
-            else if (l_errCode)
+            catch (const std::exception& l_ex)
             {
-                m_logger->logMessage(
-                    "Failed to check if system is Pass 1 Planar, error : " +
-                        commonUtility::getErrCodeMsg(l_errCode),
-                    PlaceHolder::COLLECTION);
+                throwParsingFailure(l_vpdFilePath, l_ex);
             }
+
+            if (std::holds_alternative<std::monostate>(l_parsedVpdMap))
+            {
+                onFruCollectionSuccess(l_vpdFilePath, true);
+                continue;
+            }
+
+            types::ObjectMap l_objectInterfaceMap;
+            {
+                const TraceSpan l_span("PopulateDbus", l_vpdFilePath);
+                populateDbus(l_parsedVpdMap, l_objectInterfaceMap,
+                             l_vpdFilePath);
+            }
+
+            if (!o_publishQueue.push(std::make_pair(
+                    l_vpdFilePath, std::move(l_objectInterfaceMap))))
+            {
+                onFruCollectionDropped(l_vpdFilePath);
+            }
+        }
+        catch (const std::exception& l_ex)
+        {
+            onFruCollectionFailure(l_vpdFilePath, l_ex);
         }
+    }
+}
 
-        EventLogger::createSyncPel(
-            EventLogger::getErrorType(ex),
-            (typeid(ex) == typeid(DataException)) ||
-                    (typeid(ex) == typeid(EccException))
-                ? types::SeverityType::Warning
-                : types::SeverityType::Informational,
-            __FILE__, __FUNCTION__, 0, EventLogger::getErrorMsg(ex),
-            std::nullopt, std::nullopt, std::nullopt, std::nullopt);
+void Worker::runCollectionPublishStage(
+    BoundedQueue<types::EepromObjectMap>& i_publishQueue)
+{
+    size_t l_publishedFruCount = 0;
+    size_t l_batchCount = 0;
 
-        // TODO: Figure out a way to clear data in case of any failure at
-        // runtime.
+    while (auto l_fruData = i_publishQueue.pop())
+    {
+        std::vector<types::EepromObjectMap> l_batch;
+        l_batch.push_back(std::move(*l_fruData));
 
-        // set present property to false for any error case. In future this will
-        // be replaced by presence logic.
-        // Update Present property for this FRU only if we handle Present
-        // property for the FRU.
-        if (isPresentPropertyHandlingRequired(
-                m_parsedJson["frus"][i_vpdFilePath].at(0)))
+        // Take along the FRUs which are already waiting to be published.
+        while (l_batch.size() < constants::COLLECTION_PUBLISH_BATCH_SIZE)
         {
-            setPresentProperty(i_vpdFilePath, false);
+            auto l_nextFruData = i_publishQueue.tryPop();
+            if (!l_nextFruData.has_value())
+            {
+                break;
+            }
+            l_batch.push_back(std::move(*l_nextFruData));
         }
 
-        m_semaphore.release();
-        return std::make_tuple(false, i_vpdFilePath);
+        ++l_batchCount;
+        Metrics::getMetricsInstance().observe(Histogram::PimNotifyBatchSize,
+                                              l_batch.size());
+
+        bool l_isPublished = false;
+        {
+            const std::string l_batchContext =
+                std::to_string(l_batch.size()) + " FRU(s)";
+            const TraceSpan l_span("PimNotify", l_batchContext);
+
+            // PIM is not updated while keywords are being written.
+            std::shared_lock l_vpdAccessLock(getVpdAccessMutex());
+
+            // Call dbus method to update on dbus. D-Bus data of a batch of
+            // FRUs is kept, to publish them one by one if the batch fails.
+            l_isPublished = dbusUtility::publishVpdOnDBus(
+                (l_batch.size() == constants::VALUE_1)
+                    ? types::ObjectMap(std::move(l_batch.front().second))
+                    : getBatchedObjectMap(l_batch));
+        }
+
+        if (l_isPublished)
+        {
+            for (const auto& l_fruData : l_batch)
+            {
+                onFruCollectionSuccess(l_fruData.first);
+            }
+            l_publishedFruCount += l_batch.size();
+            continue;
+        }
+
+        const std::runtime_error l_ex(
+            std::string(__FUNCTION__) +
+            "Call to PIM failed while publishing VPD.");
+
+        if (l_batch.size() == constants::VALUE_1)
+        {
+            onFruCollectionFailure(l_batch.front().first, l_ex);
+            continue;
+        }
+
+        // Publish FRUs of the failed batch one by one, so that a FRU rejected
+        // by PIM doesn't fail the others.
+        m_logger->logMessage("Call to PIM failed for a batch of " +
+                                 std::to_string(l_batch.size()) +
+                                 " FRU(s), publishing them one by one.",
+                             PlaceHolder::COLLECTION);
+
+        for (auto& [l_vpdFilePath, l_objectInterfaceMap] : l_batch)
+        {
+            ++l_batchCount;
+            std::shared_lock l_vpdAccessLock(getVpdAccessMutex());
+            const bool l_isFruPublished =
+                dbusUtility::publishVpdOnDBus(std::move(l_objectInterfaceMap));
+            l_vpdAccessLock.unlock();
+
+            if (l_isFruPublished)
+            {
+                onFruCollectionSuccess(l_vpdFilePath);
+                ++l_publishedFruCount;
+            }
+            else
+            {
+                onFruCollectionFailure(l_vpdFilePath, l_ex);
+            }
+        }
+    }
+
+    m_logger->logMessage("Published VPD of " +
+                             std::to_string(l_publishedFruCount) +
+                             " FRU(s) in " + std::to_string(l_batchCount) +
+                             " call(s) to PIM.",
+                         PlaceHolder::COLLECTION);
+}
+
+types::ObjectMap Worker::getBatchedObjectMap(
+    const std::vector<types::EepromObjectMap>& i_batch) const
+{
+    types::ObjectMap l_objectInterfaceMap;
+
+    for (const auto& [l_vpdFilePath, l_fruObjectMap] : i_batch)
+    {
+        for (const auto& [l_objectPath, l_interfaceMap] : l_fruObjectMap)
+        {
+            auto& l_batchedInterfaceMap = l_objectInterfaceMap[l_objectPath];
+            for (const auto& [l_interface, l_propertyMap] : l_interfaceMap)
+            {
+                uint16_t l_errCode = 0;
+                vpdSpecificUtility::insertOrMerge(l_batchedInterfaceMap,
+                                                  l_interface,
+                                                  types::PropertyMap(
+                                                      l_propertyMap),
+                                                  l_errCode);
+
+                if (l_errCode)
+                {
+                    m_logger->logMessage(
+                        "Failed to merge interface [" + l_interface +
+                            "] for path [" + l_vpdFilePath + "], error : " +
+                            commonUtility::getErrCodeMsg(l_errCode),
+                        PlaceHolder::COLLECTION);
+                }
+            }
+        }
     }
+
+    return l_objectInterfaceMap;
 }
 
 bool Worker::skipPathForCollection(const std::string& i_vpdFilePath)
@@ -1136,6 +1532,44 @@ bool Worker::skipPathForCollection(const std::string& i_vpdFilePath)
     return false;
 }
 
+void Worker::launchCollectionStage(size_t i_threadCount,
+                                   const std::function<void()>& i_stage,
+                                   const std::function<void()>& i_onStageDone)
+{
+    // Stage needs at least one thread to drain the queue feeding it.
+    const size_t l_threadCount = std::max(i_threadCount, size_t{1});
+
+    auto l_runningThreadCount =
+        std::make_shared<std::atomic<size_t>>(l_threadCount);
+
+    const auto l_onThreadDone = [l_runningThreadCount, i_onStageDone]() {
+        if (l_runningThreadCount->fetch_sub(1) == 1)
+        {
+            i_onStageDone();
+        }
+    };
+
+    for (size_t l_thread = 0; l_thread < l_threadCount; ++l_thread)
+    {
+        try
+        {
+            std::thread{[i_stage, l_onThreadDone]() {
+                i_stage();
+                l_onThreadDone();
+            }}.detach();
+        }
+        catch (const std::exception& l_ex)
+        {
+            m_logger->logMessage(
+                "Failed to launch VPD collection thread, error : " +
+                    std::string(l_ex.what()),
+                PlaceHolder::COLLECTION);
+
+            l_onThreadDone();
+        }
+    }
+}
+
 void Worker::collectFrusFromJson()
 {
     // A parsed JSON file should be present to pick FRUs EEPROM paths
@@ -1147,39 +1581,226 @@ void Worker::collectFrusFromJson()
             m_configJsonPath);
     }
 
+    // Objects already hosted by PIM are fetched once for all the FRUs. The
+    // cache is then kept up to date as collected FRUs get published.
+    uint16_t l_errCode = 0;
+    dbusUtility::refreshPimObjectCache(l_errCode);
+
+    if (l_errCode)
+    {
+        // Objects are then looked up one by one, as and when required.
+        logging::logMessage(
+            "Failed to load objects hosted by PIM, error : " +
+            commonUtility::getErrCodeMsg(l_errCode));
+    }
+
     const nlohmann::json& listOfFrus =
         m_parsedJson["frus"].get_ref<const nlohmann::json::object_t&>();
 
+    std::vector<std::string> l_eepromsToCollect;
     for (const auto& itemFRUS : listOfFrus.items())
     {
-        const std::string& vpdFilePath = itemFRUS.key();
+        if (!skipPathForCollection(itemFRUS.key()))
+        {
+            l_eepromsToCollect.push_back(itemFRUS.key());
+        }
+    }
+
+    collectFrus(l_eepromsToCollect, [this]() { m_isAllFruCollected = true; });
+}
+
+void Worker::collectFrus(const std::vector<std::string>& i_eepromsToCollect,
+                         const std::function<void()>& i_onCollectionDone)
+{
+    m_mutex.lock();
+    m_activeCollectionThreadCount += i_eepromsToCollect.size();
+    m_mutex.unlock();
+
+    if (i_eepromsToCollect.empty())
+    {
+        onFruCollectionDone(i_onCollectionDone);
+        return;
+    }
+
+    // Group EEPROMs based on their collection priority.
+    std::map<uint8_t, std::vector<std::string>, std::greater<uint8_t>>
+        l_eepromsByPriority;
+    for (const auto& l_vpdFilePath : i_eepromsToCollect)
+    {
+        uint16_t l_errCode = 0;
+        const auto l_priority = jsonUtility::getFruCollectionPriority(
+            m_parsedJson, l_vpdFilePath, l_errCode);
 
-        if (skipPathForCollection(vpdFilePath))
+        if (l_errCode)
         {
-            continue;
+            m_logger->logMessage(
+                "Failed to get collection priority for FRU [" +
+                    l_vpdFilePath +
+                    "], error : " + commonUtility::getErrCodeMsg(l_errCode),
+                PlaceHolder::COLLECTION);
         }
 
-        try
+        l_eepromsByPriority[l_priority].push_back(l_vpdFilePath);
+    }
+
+    // Feed EEPROMs in order of priority. EEPROMs of the same priority are fed
+    // in an order which keeps all the buses busy.
+    auto l_eepromQueue =
+        std::make_shared<BoundedQueue<std::string>>(i_eepromsToCollect.size());
+    for (const auto& [l_priority, l_eeproms] : l_eepromsByPriority)
+    {
+        for (auto& l_vpdFilePath : m_ioScheduler->getScheduledOrder(l_eeproms))
         {
-            std::thread{[vpdFilePath, this]() {
-                const auto& l_parseResult = parseAndPublishVPD(vpdFilePath);
+            l_eepromQueue->push(std::move(l_vpdFilePath));
+        }
+    }
+    l_eepromQueue->close();
+
+    auto l_parseQueue = std::make_shared<BoundedQueue<types::EepromVpdData>>(
+        constants::COLLECTION_STAGE_QUEUE_DEPTH);
+    auto l_publishQueue =
+        std::make_shared<BoundedQueue<types::EepromObjectMap>>(
+            constants::COLLECTION_STAGE_QUEUE_DEPTH);
+
+    // A stage finishing closes the queue it feeds. FRUs left in the queue
+    // feeding it, in case threads of the stage could not be launched, are
+    // marked as dropped. Collection is over only once all the stages are done,
+    // as a stage can finish while the stages feeding it are still running.
+    auto l_runningStageCount = std::make_shared<std::atomic<size_t>>(3);
+    const auto l_onStageDone = [this, l_runningStageCount, l_parseQueue,
+                                l_publishQueue, i_onCollectionDone]() {
+        if (l_runningStageCount->fetch_sub(1) != 1)
+        {
+            return;
+        }
 
-                m_mutex.lock();
-                m_activeCollectionThreadCount--;
-                m_mutex.unlock();
+        Metrics& l_metrics = Metrics::getMetricsInstance();
+        l_metrics.setGauge(Gauge::ParseQueueMaxDepth,
+                           l_parseQueue->getMaxDepth());
+        l_metrics.setGauge(Gauge::PublishQueueMaxDepth,
+                           l_publishQueue->getMaxDepth());
 
-                if (!m_activeCollectionThreadCount)
-                {
-                    m_isAllFruCollected = true;
-                }
-            }}.detach();
+        m_logger->logMessage(
+            "FRU VPD collection pipeline done. Max queue depth, parse stage: " +
+                std::to_string(l_parseQueue->getMaxDepth()) +
+                ", publish stage: " +
+                std::to_string(l_publishQueue->getMaxDepth()),
+            PlaceHolder::COLLECTION);
+
+        onFruCollectionDone(i_onCollectionDone);
+    };
+
+    // Publish stage, single thread so that PIM gets one call at a time.
+    launchCollectionStage(
+        1,
+        [this, l_publishQueue]() {
+            runCollectionPublishStage(*l_publishQueue);
+        },
+        [this, l_publishQueue, l_onStageDone]() {
+            l_publishQueue->close();
+            while (auto l_fruData = l_publishQueue->tryPop())
+            {
+                onFruCollectionDropped(l_fruData->first);
+            }
+            l_onStageDone();
+        });
+
+    launchCollectionStage(
+        constants::COLLECTION_PARSE_STAGE_THREADS,
+        [this, l_parseQueue, l_publishQueue]() {
+            runCollectionParseStage(*l_parseQueue, *l_publishQueue);
+        },
+        [this, l_parseQueue, l_publishQueue, l_onStageDone]() {
+            l_parseQueue->close();
+            while (auto l_vpdData = l_parseQueue->tryPop())
+            {
+                onFruCollectionDropped(std::get<0>(*l_vpdData));
+            }
+            l_publishQueue->close();
+            l_onStageDone();
+        });
+
+    launchCollectionStage(
+        m_ioStageThreadCount,
+        [this, l_eepromQueue, l_parseQueue]() {
+            runCollectionIoStage(*l_eepromQueue, *l_parseQueue);
+        },
+        [this, l_eepromQueue, l_parseQueue, l_onStageDone]() {
+            while (auto l_vpdFilePath = l_eepromQueue->tryPop())
+            {
+                onFruCollectionDropped(*l_vpdFilePath);
+            }
+            l_parseQueue->close();
+            l_onStageDone();
+        });
+}
+
+void Worker::onFruCollectionDone(
+    const std::function<void()>& i_onCollectionDone)
+{
+    if (i_onCollectionDone)
+    {
+        i_onCollectionDone();
+    }
+
+    std::function<void()> l_onRetryPending;
+    {
+        std::scoped_lock l_lock(m_mutex);
+        if (!m_failedEepromPaths.empty())
+        {
+            l_onRetryPending = m_onFruCollectionRetryPending;
         }
-        catch (const std::exception& l_ex)
+    }
+
+    if (l_onRetryPending)
+    {
+        l_onRetryPending();
+    }
+}
+
+void Worker::retryFruCollection(
+    const std::vector<std::string>& i_eepromsToRetry)
+{
+    m_logger->logMessage("Retrying VPD collection of " +
+                             std::to_string(i_eepromsToRetry.size()) +
+                             " FRU(s)",
+                         PlaceHolder::COLLECTION);
+
+    {
+        std::scoped_lock l_lock(m_mutex);
+        for (const auto& l_vpdFilePath : i_eepromsToRetry)
         {
-            // add vpdFilePath(EEPROM path) to failed list
-            m_failedEepromPaths.push_front(vpdFilePath);
+            ++m_fruCollectionRetryCount[l_vpdFilePath];
         }
     }
+
+    for (const auto& l_vpdFilePath : i_eepromsToRetry)
+    {
+        Metrics::getMetricsInstance().incrementEepromRetries(l_vpdFilePath);
+    }
+
+    collectFrus(i_eepromsToRetry, nullptr);
+}
+
+std::forward_list<std::string> Worker::takeFailedEepromPaths()
+{
+    std::scoped_lock l_lock(m_mutex);
+    return std::exchange(m_failedEepromPaths, {});
+}
+
+void Worker::enableFruCollectionRetry(
+    const std::function<void()>& i_onRetryPending)
+{
+    std::scoped_lock l_lock(m_mutex);
+    m_onFruCollectionRetryPending = i_onRetryPending;
+}
+
+uint8_t Worker::getFruCollectionRetryCount(const std::string& i_vpdFilePath)
+{
+    std::scoped_lock l_lock(m_mutex);
+
+    const auto l_itr = m_fruCollectionRetryCount.find(i_vpdFilePath);
+    return (l_itr != m_fruCollectionRetryCount.end()) ? l_itr->second : 0;
 }
 
 void Worker::deleteFruVpd(const std::string& i_dbusObjPath)
@@ -1189,6 +1810,8 @@ void Worker::deleteFruVpd(const std::string& i_dbusObjPath)
         throw std::runtime_error("Given DBus object path is empty.");
     }
 
+    std::scoped_lock l_vpdAccessLock(getVpdAccessMutex());
+
     uint16_t l_errCode = 0;
     const std::string& l_fruPath =
         jsonUtility::getFruPathFromJson(m_parsedJson, i_dbusObjPath, l_errCode);
@@ -1225,6 +1848,8 @@ void Worker::deleteFruVpd(const std::string& i_dbusObjPath)
                 "], error : " + commonUtility::getErrCodeMsg(l_errCode));
         }
 
+        VpdCache::getVpdCacheInstance().invalidate(l_fruPath);
+
         vpdSpecificUtility::resetObjTreeVpd(l_fruPath, m_parsedJson, l_errCode);
 
         if (l_errCode)
@@ -1369,7 +1994,9 @@ void Worker::setPresentProperty(const std::string& i_vpdPath,
     }
 }
 
-void Worker::performVpdRecollection()
+bool Worker::performVpdRecollection(
+    const std::function<void(const std::vector<std::string>&)>&
+        i_onRecollectionDone)
 {
     try
     {
@@ -1380,6 +2007,15 @@ void Worker::performVpdRecollection()
                 "System config json object is empty, can't process recollection.");
         }
 
+        {
+            std::scoped_lock l_lock(m_mutex);
+            if (m_activeCollectionThreadCount != 0)
+            {
+                throw std::runtime_error(
+                    "VPD collection is in progress, can't process recollection.");
+            }
+        }
+
         uint16_t l_errCode = 0;
         const auto& l_frusReplaceableAtStandby =
             jsonUtility::getListOfFrusReplaceableAtStandby(m_parsedJson,
@@ -1390,30 +2026,98 @@ void Worker::performVpdRecollection()
             logging::logMessage(
                 "Failed to get list of FRUs replaceable at runtime, error : " +
                 commonUtility::getErrCodeMsg(l_errCode));
-            return;
+            return false;
         }
 
+        const bool l_isHostRunning = dbusUtility::isHostRunning();
+
+        std::vector<std::string> l_eepromsToCollect;
         for (const auto& l_fruInventoryPath : l_frusReplaceableAtStandby)
         {
-            // ToDo: Add some logic/trace to know the flow to
-            // collectSingleFruVpd has been directed via
-            // performVpdRecollection.
-            collectSingleFruVpd(l_fruInventoryPath);
+            const std::string l_fruPath = jsonUtility::getFruPathFromJson(
+                m_parsedJson, l_fruInventoryPath, l_errCode);
+
+            if (l_fruPath.empty())
+            {
+                logging::logMessage(
+                    "Failed to get FRU path for [" + l_fruInventoryPath +
+                    "], error : " + commonUtility::getErrCodeMsg(l_errCode) +
+                    ". Skipping recollection of the FRU.");
+                continue;
+            }
+
+            // While host is running, only FRUs replaceable at runtime can be
+            // recollected.
+            if (l_isHostRunning && !jsonUtility::isFruReplaceableAtRuntime(
+                                       m_parsedJson, l_fruPath, l_errCode))
+            {
+                continue;
+            }
+
+            if (std::find(l_eepromsToCollect.cbegin(),
+                          l_eepromsToCollect.cend(),
+                          l_fruPath) == l_eepromsToCollect.cend())
+            {
+                l_eepromsToCollect.push_back(l_fruPath);
+            }
+        }
+
+        if (m_isRecollectionInProgress.exchange(true))
+        {
+            logging::logMessage(
+                "VPD recollection is already in progress, skipping request.");
+            return false;
         }
-        return;
-    }
 
+        m_logger->logMessage("VPD recollection started for " +
+                             std::to_string(l_eepromsToCollect.size()) +
+                             " FRU(s).");
+
+        {
+            std::scoped_lock l_lock(m_mutex);
+            m_eepromsUnderRecollection.clear();
+            m_eepromsUnderRecollection.insert(l_eepromsToCollect.cbegin(),
+                                              l_eepromsToCollect.cend());
+            m_failedRecollectionEeproms.clear();
+        }
+
+        // Recollected FRUs go through the same pipeline as boot time
+        // collection, the API returns once the pipeline is launched. Failed
+        // FRUs are queued for retry once the callback returns.
+        collectFrus(l_eepromsToCollect, [this, i_onRecollectionDone]() {
+            std::vector<std::string> l_failedEeproms;
+            {
+                std::scoped_lock l_lock(m_mutex);
+                l_failedEeproms.swap(m_failedRecollectionEeproms);
+                m_eepromsUnderRecollection.clear();
+            }
+
+            m_logger->logMessage(
+                "VPD recollection done, " +
+                std::to_string(l_failedEeproms.size()) + " FRU(s) failed.");
+            m_isRecollectionInProgress = false;
+
+            if (i_onRecollectionDone)
+            {
+                i_onRecollectionDone(l_failedEeproms);
+            }
+        });
+        return true;
+    }
     catch (const std::exception& l_ex)
     {
         // TODO Log PEL
         logging::logMessage(
             "VPD recollection failed with error: " + std::string(l_ex.what()));
     }
+    return false;
 }
 
 void Worker::collectSingleFruVpd(
     const sdbusplus::message::object_path& i_dbusObjPath)
 {
+    std::scoped_lock l_vpdAccessLock(getVpdAccessMutex());
+
     std::string l_fruPath{};
     uint16_t l_errCode = 0;
 
@@ -15,6 +15,20 @@ namespace vpd
 {
 namespace utils
 {
+/**
+ * @brief API to get D-Bus connection of vpd-tool.
+ *
+ * vpd-tool makes all its D-Bus calls from the main thread, so a single
+ * connection, opened on the first call, serves the whole run of the tool.
+ *
+ * @return D-Bus connection.
+ */
+inline sdbusplus::bus_t& getBus()
+{
+    static sdbusplus::bus_t l_bus = sdbusplus::bus::new_default();
+    return l_bus;
+}
+
 /**
  * @brief An API to read property from Dbus.
  *
@@ -55,7 +69,7 @@ inline types::DbusVariantType readDbusProperty(
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method =
             l_bus.new_method_call(i_serviceName.c_str(), i_objectPath.c_str(),
                                   "org.freedesktop.DBus.Properties", "Get");
@@ -103,7 +117,7 @@ inline types::PropertyMap getPropertyMap(
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method =
             l_bus.new_method_call(i_service.c_str(), i_objectPath.c_str(),
                                   "org.freedesktop.DBus.Properties", "GetAll");
@@ -203,7 +217,7 @@ inline types::DbusVariantType readKeywordFromHardware(
     {
         types::DbusVariantType l_propertyValue;
 
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
 
         auto l_method = l_bus.new_method_call(
             constants::vpdManagerService, constants::vpdManagerObjectPath,
@@ -327,7 +341,7 @@ inline int writeKeyword(const std::string& i_vpdPath,
     }
 
     int l_rc = constants::FAILURE;
-    auto l_bus = sdbusplus::bus::new_default();
+    auto& l_bus = getBus();
 
     auto l_method = l_bus.new_method_call(
         constants::vpdManagerService, constants::vpdManagerObjectPath,
@@ -366,7 +380,7 @@ inline int writeKeywordOnHardware(
     }
 
     int l_rc = constants::FAILURE;
-    auto l_bus = sdbusplus::bus::new_default();
+    auto& l_bus = getBus();
 
     auto l_method = l_bus.new_method_call(
         constants::vpdManagerService, constants::vpdManagerObjectPath,
@@ -524,7 +538,7 @@ inline types::MapperGetObject GetServiceInterfacesForObject(
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::objectMapperService, constants::objectMapperObjectPath,
             constants::objectMapperInfName, "GetObject");
@@ -566,7 +580,7 @@ inline std::vector<std::string> GetSubTreePaths(
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::objectMapperService, constants::objectMapperObjectPath,
             constants::objectMapperInfName, "GetSubTreePaths");
@@ -886,7 +900,7 @@ inline bool isServiceRunning(const std::string& i_serviceName) noexcept
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::dbusService, constants::dbusObjectPath,
             constants::dbusInterface, "NameHasOwner");
@@ -924,7 +938,7 @@ inline types::BiosAttributeCurrentValue biosGetAttributeMethodCall(
 
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = getBus();
         auto l_method = l_bus.new_method_call(
             constants::biosConfigMgrService, constants::biosConfigMgrObjPath,
             constants::biosConfigMgrInterface, "GetAttribute");
@@ -4,6 +4,7 @@
 #include "logger.hpp"
 
 #include <filesystem>
+#include <vector>
 
 /**
  * @brief Class to handle backup inventory data.
@@ -46,6 +47,10 @@ class InventoryBackupHandler
      * @brief API to restore inventory data from backup file path to inventory
      * persisted path
      *
+     * Inventory manager service is stopped while primary data is replaced. If
+     * the replace fails and the service can't be started again, error code is
+     * set to SERVICE_NOT_RUNNING.
+     *
      * @param[out] o_errCode - To set error code in case of error.
      *
      * @return true if the restoration is successful, false otherwise
@@ -66,6 +71,9 @@ class InventoryBackupHandler
     /**
      * @brief API to restart inventory manager service
      *
+     * Restart is waited for, up to INVENTORY_MANAGER_JOB_TIMEOUT_SEC, and is
+     * successful only if the service is active once it completes.
+     *
      * @param[out] o_errCode - To set error code in case of error.
      *
      * @return true if inventory manager service is successfully restarted,
@@ -74,7 +82,19 @@ class InventoryBackupHandler
      */
     bool restartInventoryManagerService(uint16_t& o_errCode) const noexcept;
 
+    /**
+     * @brief API to check if inventory manager service is active
+     *
+     * @param[out] o_errCode - To set error code in case of error.
+     *
+     * @return true if inventory manager service is active, false otherwise
+     */
+    bool isInventoryManagerServiceActive(uint16_t& o_errCode) const noexcept;
+
   private:
+    // Test fixture, to test private APIs.
+    friend class InventoryBackupHandlerTest;
+
     /**
      * @brief API to check if inventory backup path has data
      *
@@ -85,6 +105,92 @@ class InventoryBackupHandler
      */
     bool checkInventoryBackupPath(uint16_t& o_errCode) const noexcept;
 
+    /**
+     * @brief API to validate inventory backup data
+     *
+     * Backup data is valid if it has only directories and non empty regular
+     * files, all under the inventory object path.
+     *
+     * @param[out] o_directories - Directories in backup, relative to backup
+     * path, parent directories first.
+     * @param[out] o_files - Files in backup, relative to backup path.
+     *
+     * @return true if backup data is valid, false otherwise
+     *
+     * @throw std::filesystem::filesystem_error
+     */
+    bool validateInventoryBackupData(
+        std::vector<std::filesystem::path>& o_directories,
+        std::vector<std::filesystem::path>& o_files) const;
+
+    /**
+     * @brief API to copy inventory backup files
+     *
+     * Files are copied in parallel, by INVENTORY_RESTORE_THREAD_COUNT threads.
+     * Directories of the files must already exist at destination.
+     *
+     * @param[in] i_files - Files to copy, relative to backup path.
+     * @param[in] i_destinationPath - Path to copy the files to.
+     *
+     * @return true if all the files are copied, false otherwise
+     */
+    bool copyInventoryBackupFiles(
+        const std::vector<std::filesystem::path>& i_files,
+        const std::filesystem::path& i_destinationPath) const noexcept;
+
+    /**
+     * @brief API to replace inventory primary data with given data
+     *
+     * Given data is synced to disk and then atomically exchanged with primary
+     * data directory, so that primary data is either old or new data, even
+     * across a power loss. Old data is removed afterwards.
+     *
+     * Inventory manager service must be stopped, so that it doesn't write to
+     * primary data meanwhile.
+     *
+     * @param[in] i_dataPath - Path of data to replace primary data with. It
+     * must be on the same file system as primary data.
+     *
+     * @throw std::filesystem::filesystem_error
+     */
+    void replaceInventoryPrimaryData(
+        const std::filesystem::path& i_dataPath) const;
+
+    /**
+     * @brief API to execute a job on inventory manager service and wait for
+     * it to complete
+     *
+     * @param[in] i_method - systemd manager method to queue the job, e.g.
+     * "RestartUnit".
+     *
+     * @return true if the job completed within
+     * INVENTORY_MANAGER_JOB_TIMEOUT_SEC, false otherwise
+     *
+     * @throw sdbusplus::exception::SdBusError
+     */
+    bool executeInventoryManagerJob(const std::string& i_method) const;
+
+    /**
+     * @brief API to get active state of inventory manager service
+     *
+     * @return Active state of the service unit, e.g. "active"
+     *
+     * @throw sdbusplus::exception::SdBusError
+     */
+    std::string getInventoryManagerActiveState() const;
+
+    /**
+     * @brief API to sync a file or directory to disk
+     *
+     * @param[in] i_path - Path to sync.
+     * @param[in] i_isRecursive - Whether to sync everything under the path
+     * as well.
+     *
+     * @throw std::filesystem::filesystem_error
+     */
+    void syncToDisk(const std::filesystem::path& i_path,
+                    bool i_isRecursive) const;
+
     /* Members */
     // inventory manager service name
     std::string m_inventoryManagerServiceName;
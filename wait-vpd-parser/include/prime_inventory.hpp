@@ -51,20 +51,27 @@ class PrimeInventory
      * interface. If the dbus count is equal to or greater than the count from
      * JSON config consider as priming is not required.
      *
+     * @param[in] i_pimObjects - Objects under PIM.
+     *
      * @return true if priming is required, false otherwise.
      */
-    bool isPrimingRequired() const noexcept;
+    bool isPrimingRequired(
+        const vpd::types::ObjectMap& i_pimObjects) const noexcept;
 
     /**
      * @brief API to prime inventory Objects.
      *
      * @param[out] o_objectInterfaceMap - Interface and its properties map.
      * @param[in] i_fruJsonObj - FRU json object.
+     * @param[in] i_pimObjects - Objects under PIM.
+     * @param[in] i_isChassisPowerOn - Whether chassis is powered on.
      *
      * @return true if the prime inventory is success, false otherwise.
      */
     bool primeInventory(vpd::types::ObjectMap& o_objectInterfaceMap,
-                        const nlohmann::json& i_fruJsonObj) const noexcept;
+                        const nlohmann::json& i_fruJsonObj,
+                        const vpd::types::ObjectMap& i_pimObjects,
+                        bool i_isChassisPowerOn) const noexcept;
 
     /**
      * @brief API to populate all required interface for a FRU.
@@ -105,12 +112,12 @@ class PrimeInventory
      * populated, the functions skips re-populating the property so that already
      * existing value can be retained.
      *
-     * @param[in] i_inventoryObjPath - Inventory path as read from config JSON.
+     * @param[in] i_pimInterfaceMap - FRU's interfaces under PIM.
      * @param[in,out] io_interfaces - Map to hold all the interfaces for the
      * FRU.
      */
     void processFunctionalProperty(
-        const std::string& i_inventoryObjPath,
+        const vpd::types::InterfaceMap& i_pimInterfaceMap,
         vpd::types::InterfaceMap& io_interfaces) const noexcept;
 
     /**
@@ -122,12 +129,12 @@ class PrimeInventory
      * populated, the functions skips re-populating the property so that already
      * existing value can be retained.
      *
-     * @param[in] i_inventoryObjPath - Inventory path as read from config JSON.
+     * @param[in] i_pimInterfaceMap - FRU's interfaces under PIM.
      * @param[in,out] io_interfaces - Map to hold all the interfaces for the
      * FRU.
      */
     void processEnabledProperty(
-        const std::string& i_inventoryObjPath,
+        const vpd::types::InterfaceMap& i_pimInterfaceMap,
         vpd::types::InterfaceMap& io_interfaces) const noexcept;
 
     // Parsed JSON file.
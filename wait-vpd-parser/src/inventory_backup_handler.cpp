@@ -2,6 +2,17 @@
 
 #include "error_codes.hpp"
 #include "utility/common_utility.hpp"
+#include "utility/dbus_utility.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <system_error>
+#include <thread>
 
 bool InventoryBackupHandler::checkInventoryBackupPath(
     uint16_t& o_errCode) const noexcept
@@ -46,6 +57,7 @@ bool InventoryBackupHandler::restoreInventoryBackupData(
     uint16_t& o_errCode) const noexcept
 {
     bool l_rc{false};
+    bool l_isServiceStopped{false};
     o_errCode = 0;
     try
     {
@@ -60,12 +72,85 @@ bool InventoryBackupHandler::restoreInventoryBackupData(
             return l_rc;
         }
 
-        /* TODO:
-            1. Iterate through directories under
-           /var/lib/phosphor-data-sync/bmc_data_bkp/
-            2. Extract the object path and interface information
-            3. Restore the data to inventory manager persisted path.
-        */
+        std::vector<std::filesystem::path> l_directories;
+        std::vector<std::filesystem::path> l_files;
+        if (!validateInventoryBackupData(l_directories, l_files))
+        {
+            m_logger->logMessage("Inventory backup data at [" +
+                                 m_inventoryBackupPath.string() +
+                                 "] is not valid, skip restoring it");
+            return l_rc;
+        }
+
+        // Backup data is restored in a staging directory next to primary
+        // data, so that it can be swapped in atomically.
+        const std::filesystem::path l_stagingPath{
+            m_inventoryPrimaryPath.string() + ".restore"};
+
+        std::filesystem::remove_all(l_stagingPath);
+        std::filesystem::create_directories(l_stagingPath);
+        for (const auto& l_directory : l_directories)
+        {
+            std::filesystem::create_directory(l_stagingPath / l_directory);
+        }
+
+        if (!copyInventoryBackupFiles(l_files, l_stagingPath))
+        {
+            std::filesystem::remove_all(l_stagingPath);
+            throw std::runtime_error("Failed to copy inventory backup files");
+        }
+
+        // Service is started again by the restart which follows restore.
+        if (!executeInventoryManagerJob("StopUnit"))
+        {
+            std::filesystem::remove_all(l_stagingPath);
+            throw std::runtime_error("Timed out stopping " +
+                                     m_inventoryManagerServiceName);
+        }
+
+        try
+        {
+            replaceInventoryPrimaryData(l_stagingPath);
+        }
+        catch (const std::exception& l_ex)
+        {
+            std::error_code l_ec;
+            std::filesystem::remove_all(l_stagingPath, l_ec);
+
+            // Primary data is left as is, start the service again on it.
+            bool l_isStarted{false};
+            for (unsigned l_attempt = vpd::constants::VALUE_1;
+                 !l_isStarted && l_attempt <= vpd::constants::VALUE_3;
+                 ++l_attempt)
+            {
+                try
+                {
+                    l_isStarted = executeInventoryManagerJob("StartUnit") &&
+                                  (getInventoryManagerActiveState() ==
+                                   "active");
+                }
+                catch (const sdbusplus::exception::SdBusError& l_startEx)
+                {
+                    m_logger->logMessage(
+                        "Attempt " + std::to_string(l_attempt) + " to start " +
+                        m_inventoryManagerServiceName +
+                        " failed. Error: " + std::string(l_startEx.what()));
+                }
+            }
+
+            if (!l_isStarted)
+            {
+                m_logger->logMessage("Failed to start " +
+                                     m_inventoryManagerServiceName +
+                                     " after failed restore");
+                l_isServiceStopped = true;
+            }
+            throw;
+        }
+
+        m_logger->logMessage("Restored " + std::to_string(l_files.size()) +
+                             " inventory files from backup");
+        l_rc = true;
     }
     catch (const std::exception& l_ex)
     {
@@ -84,7 +169,8 @@ bool InventoryBackupHandler::restoreInventoryBackupData(
                                  "] Error: " + std::string(l_ex.what()),
                              vpd::PlaceHolder::PEL, &l_pelInfo);
 
-        o_errCode = vpd::error_code::STANDARD_EXCEPTION;
+        o_errCode = l_isServiceStopped ? vpd::error_code::SERVICE_NOT_RUNNING
+                                       : vpd::error_code::STANDARD_EXCEPTION;
     }
     return l_rc;
 }
@@ -96,9 +182,21 @@ bool InventoryBackupHandler::clearInventoryBackupData(
     o_errCode = 0;
     try
     {
-        /* TODO:
-           Clear all directories under inventory backup path
-        */
+        if (std::filesystem::exists(m_inventoryBackupPath))
+        {
+            std::vector<std::filesystem::path> l_entries;
+            for (const auto& l_entry :
+                 std::filesystem::directory_iterator(m_inventoryBackupPath))
+            {
+                l_entries.push_back(l_entry.path());
+            }
+
+            for (const auto& l_entry : l_entries)
+            {
+                std::filesystem::remove_all(l_entry);
+            }
+        }
+        l_rc = true;
     }
     catch (const std::exception& l_ex)
     {
@@ -129,14 +227,40 @@ bool InventoryBackupHandler::restartInventoryManagerService(
     o_errCode = 0;
     try
     {
-        /* TODO:
-           1. Restart inventory manager service, with a re-try limit of 3
-           attempts
-           2. If above step fails, check inventory manager service state
-           3. If service is in running state, then log critical PEL and go for
-           re-collection. If not running then along with critical PEL, fail this
-           service as well.
-        */
+        for (unsigned l_attempt = vpd::constants::VALUE_1;
+             !l_rc && l_attempt <= vpd::constants::VALUE_3; ++l_attempt)
+        {
+            try
+            {
+                if (!executeInventoryManagerJob("RestartUnit"))
+                {
+                    m_logger->logMessage(
+                        "Attempt " + std::to_string(l_attempt) +
+                        " to restart " + m_inventoryManagerServiceName +
+                        " timed out");
+                    continue;
+                }
+
+                const std::string l_activeState{
+                    getInventoryManagerActiveState()};
+
+                l_rc = (l_activeState == "active");
+                if (!l_rc)
+                {
+                    m_logger->logMessage(
+                        "Attempt " + std::to_string(l_attempt) +
+                        " to restart " + m_inventoryManagerServiceName +
+                        " left it " + l_activeState);
+                }
+            }
+            catch (const sdbusplus::exception::SdBusError& l_ex)
+            {
+                m_logger->logMessage(
+                    "Attempt " + std::to_string(l_attempt) + " to restart " +
+                    m_inventoryManagerServiceName +
+                    " failed. Error: " + std::string(l_ex.what()));
+            }
+        }
     }
     catch (const std::exception& l_ex)
     {
@@ -147,3 +271,265 @@ bool InventoryBackupHandler::restartInventoryManagerService(
     }
     return l_rc;
 }
+
+bool InventoryBackupHandler::isInventoryManagerServiceActive(
+    uint16_t& o_errCode) const noexcept
+{
+    o_errCode = 0;
+    try
+    {
+        return getInventoryManagerActiveState() == "active";
+    }
+    catch (const std::exception& l_ex)
+    {
+        m_logger->logMessage("Failed to get state of " +
+                             m_inventoryManagerServiceName +
+                             ". Error: " + std::string(l_ex.what()));
+        o_errCode = vpd::error_code::STANDARD_EXCEPTION;
+    }
+    return false;
+}
+
+bool InventoryBackupHandler::executeInventoryManagerJob(
+    const std::string& i_method) const
+{
+    auto& l_bus = vpd::dbusUtility::getBus();
+    auto l_method = l_bus.new_method_call(
+        vpd::constants::systemdService, vpd::constants::systemdObjectPath,
+        vpd::constants::systemdManagerInterface, i_method.c_str());
+    l_method.append(m_inventoryManagerServiceName + ".service", "replace");
+
+    sdbusplus::message::object_path l_jobPath;
+    l_bus.call(l_method).read(l_jobPath);
+
+    const auto l_deadline =
+        std::chrono::steady_clock::now() +
+        std::chrono::seconds(vpd::constants::INVENTORY_MANAGER_JOB_TIMEOUT_SEC);
+
+    // Job object is removed once the job completes, its state can't be read
+    // then.
+    while (std::holds_alternative<std::string>(
+        vpd::dbusUtility::readDbusProperty(vpd::constants::systemdService,
+                                           l_jobPath,
+                                           vpd::constants::systemdJobInterface,
+                                           "State")))
+    {
+        if (std::chrono::steady_clock::now() >= l_deadline)
+        {
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(
+            vpd::constants::INVENTORY_MANAGER_JOB_POLL_INTERVAL_MS));
+    }
+
+    return true;
+}
+
+std::string InventoryBackupHandler::getInventoryManagerActiveState() const
+{
+    auto& l_bus = vpd::dbusUtility::getBus();
+    auto l_method = l_bus.new_method_call(
+        vpd::constants::systemdService, vpd::constants::systemdObjectPath,
+        vpd::constants::systemdManagerInterface, "GetUnit");
+    l_method.append(m_inventoryManagerServiceName + ".service");
+
+    sdbusplus::message::object_path l_unitPath;
+    l_bus.call(l_method).read(l_unitPath);
+
+    const auto l_activeState = vpd::dbusUtility::readDbusProperty(
+        vpd::constants::systemdService, l_unitPath,
+        vpd::constants::systemdUnitInterface, "ActiveState");
+
+    if (const auto l_value = std::get_if<std::string>(&l_activeState))
+    {
+        return *l_value;
+    }
+
+    return std::string{};
+}
+
+bool InventoryBackupHandler::validateInventoryBackupData(
+    std::vector<std::filesystem::path>& o_directories,
+    std::vector<std::filesystem::path>& o_files) const
+{
+    o_directories.clear();
+    o_files.clear();
+
+    const auto l_inventoryPath{
+        std::filesystem::path(vpd::constants::pimPath).relative_path()};
+
+    // Checks if a path is same as or under a base path.
+    const auto l_isWithin = [](const std::filesystem::path& i_path,
+                               const std::filesystem::path& i_basePath) {
+        return std::mismatch(i_basePath.begin(), i_basePath.end(),
+                             i_path.begin(), i_path.end())
+                   .first == i_basePath.end();
+    };
+
+    for (const auto& l_entry :
+         std::filesystem::recursive_directory_iterator(m_inventoryBackupPath))
+    {
+        const auto l_relativePath{
+            l_entry.path().lexically_relative(m_inventoryBackupPath)};
+
+        if (l_entry.is_symlink())
+        {
+            m_logger->logMessage("Symlink [" + l_entry.path().string() +
+                                 "] found in inventory backup");
+            return false;
+        }
+
+        if (l_entry.is_directory())
+        {
+            // Directories leading to inventory path are allowed too.
+            if (!l_isWithin(l_relativePath, l_inventoryPath) &&
+                !l_isWithin(l_inventoryPath, l_relativePath))
+            {
+                m_logger->logMessage("Unexpected directory [" +
+                                     l_entry.path().string() +
+                                     "] found in inventory backup");
+                return false;
+            }
+
+            o_directories.push_back(l_relativePath);
+            continue;
+        }
+
+        if (!l_entry.is_regular_file() ||
+            !l_isWithin(l_relativePath, l_inventoryPath) ||
+            l_entry.file_size() == 0)
+        {
+            m_logger->logMessage("Invalid file [" + l_entry.path().string() +
+                                 "] found in inventory backup");
+            return false;
+        }
+
+        o_files.push_back(l_relativePath);
+    }
+
+    return !o_files.empty();
+}
+
+bool InventoryBackupHandler::copyInventoryBackupFiles(
+    const std::vector<std::filesystem::path>& i_files,
+    const std::filesystem::path& i_destinationPath) const noexcept
+{
+    std::atomic<size_t> l_nextFileIndex{0};
+    std::atomic<bool> l_isCopyFailed{false};
+
+    // Each thread picks the next file to copy, till all are copied or any
+    // copy fails.
+    const auto l_copyFiles = [this, &i_files, &i_destinationPath,
+                              &l_nextFileIndex, &l_isCopyFailed]() {
+        for (size_t l_index = l_nextFileIndex++;
+             l_index < i_files.size() && !l_isCopyFailed;
+             l_index = l_nextFileIndex++)
+        {
+            try
+            {
+                std::filesystem::copy_file(
+                    m_inventoryBackupPath / i_files[l_index],
+                    i_destinationPath / i_files[l_index],
+                    std::filesystem::copy_options::overwrite_existing);
+            }
+            catch (const std::exception& l_ex)
+            {
+                l_isCopyFailed = true;
+                m_logger->logMessage("Failed to copy inventory backup file [" +
+                                     i_files[l_index].string() +
+                                     "]. Error: " + std::string(l_ex.what()));
+            }
+        }
+    };
+
+    std::vector<std::thread> l_threads;
+    try
+    {
+        const size_t l_threadCount = std::min(
+            vpd::constants::INVENTORY_RESTORE_THREAD_COUNT, i_files.size());
+
+        for (size_t l_count = 0; l_count < l_threadCount; ++l_count)
+        {
+            l_threads.emplace_back(l_copyFiles);
+        }
+    }
+    catch (const std::exception& l_ex)
+    {
+        // Stop the threads already started.
+        l_isCopyFailed = true;
+        m_logger->logMessage("Failed to copy inventory backup files. Error: " +
+                             std::string(l_ex.what()));
+    }
+
+    for (auto& l_thread : l_threads)
+    {
+        l_thread.join();
+    }
+
+    return !l_isCopyFailed;
+}
+
+void InventoryBackupHandler::replaceInventoryPrimaryData(
+    const std::filesystem::path& i_dataPath) const
+{
+    const std::filesystem::path l_parentPath{
+        m_inventoryPrimaryPath.parent_path()};
+
+    // New data must be on disk before it is made primary data.
+    syncToDisk(i_dataPath, true);
+    syncToDisk(l_parentPath, false);
+
+    if (std::filesystem::exists(m_inventoryPrimaryPath))
+    {
+        // Data path holds old primary data after the exchange.
+        if (renameat2(AT_FDCWD, i_dataPath.c_str(), AT_FDCWD,
+                      m_inventoryPrimaryPath.c_str(), RENAME_EXCHANGE) != 0)
+        {
+            throw std::filesystem::filesystem_error(
+                "Failed to exchange inventory data", i_dataPath,
+                m_inventoryPrimaryPath,
+                std::error_code(errno, std::generic_category()));
+        }
+    }
+    else
+    {
+        std::filesystem::rename(i_dataPath, m_inventoryPrimaryPath);
+    }
+
+    syncToDisk(l_parentPath, false);
+
+    std::filesystem::remove_all(i_dataPath);
+}
+
+void InventoryBackupHandler::syncToDisk(const std::filesystem::path& i_path,
+                                        bool i_isRecursive) const
+{
+    if (i_isRecursive && std::filesystem::is_directory(i_path))
+    {
+        for (const auto& l_entry :
+             std::filesystem::recursive_directory_iterator(i_path))
+        {
+            syncToDisk(l_entry.path(), false);
+        }
+    }
+
+    const int l_fd = open(i_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (l_fd < 0)
+    {
+        throw std::filesystem::filesystem_error(
+            "Failed to open for sync", i_path,
+            std::error_code(errno, std::generic_category()));
+    }
+
+    const int l_rc = fsync(l_fd);
+    const int l_errno = errno;
+    close(l_fd);
+
+    if (l_rc != 0)
+    {
+        throw std::filesystem::filesystem_error(
+            "Failed to sync", i_path,
+            std::error_code(l_errno, std::generic_category()));
+    }
+}
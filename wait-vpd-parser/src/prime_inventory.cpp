@@ -48,14 +48,24 @@ PrimeInventory::PrimeInventory()
     }
 }
 
-bool PrimeInventory::isPrimingRequired() const noexcept
+bool PrimeInventory::isPrimingRequired(
+    const vpd::types::ObjectMap& i_pimObjects) const noexcept
 {
     try
     {
-        // get all object paths under PIM
-        const auto l_objectPaths = vpd::dbusUtility::GetSubTreePaths(
-            vpd::constants::systemInvPath, 0,
-            std::vector<std::string>{vpd::constants::vpdCollectionInterface});
+        // Count object paths under system, already primed under PIM.
+        const std::string l_systemInvPathPrefix =
+            std::string(vpd::constants::systemInvPath) + "/";
+
+        size_t l_primedPathCount = 0;
+        for (const auto& [l_objectPath, l_interfaceMap] : i_pimObjects)
+        {
+            if (l_objectPath.str.starts_with(l_systemInvPathPrefix) &&
+                l_interfaceMap.contains(vpd::constants::vpdCollectionInterface))
+            {
+                l_primedPathCount += 1;
+            }
+        }
 
         const nlohmann::json& l_listOfFrus =
             m_sysCfgJsonObj["frus"].get_ref<const nlohmann::json::object_t&>();
@@ -75,7 +85,7 @@ bool PrimeInventory::isPrimingRequired() const noexcept
                 l_invPathCount += 1;
             }
         }
-        return (l_objectPaths.size() < l_invPathCount);
+        return (l_primedPathCount < l_invPathCount);
     }
     catch (const std::exception& l_ex)
     {
@@ -93,11 +103,35 @@ void PrimeInventory::primeSystemBlueprint() const noexcept
 {
     try
     {
-        if (m_sysCfgJsonObj.empty() || !isPrimingRequired())
+        if (m_sysCfgJsonObj.empty())
+        {
+            return;
+        }
+
+        // Existing state of PIM is read in a single call, resets and defaults
+        // of all the FRUs are then computed from it. Without it, priming would
+        // reset data already on PIM, so priming is skipped.
+        uint16_t l_errCode = 0;
+        const vpd::types::ObjectMap l_pimObjects =
+            vpd::dbusUtility::getManagedObjects(vpd::constants::pimServiceName,
+                                                vpd::constants::pimPath,
+                                                l_errCode);
+
+        if (l_errCode)
+        {
+            m_logger->logMessage(
+                "Failed to get objects on PIM, skipping priming. Error: " +
+                vpd::commonUtility::getErrCodeMsg(l_errCode));
+            return;
+        }
+
+        if (!isPrimingRequired(l_pimObjects))
         {
             return;
         }
 
+        const bool l_isChassisPowerOn = vpd::dbusUtility::isChassisPowerOn();
+
         const nlohmann::json& l_listOfFrus =
             m_sysCfgJsonObj["frus"].get_ref<const nlohmann::json::object_t&>();
 
@@ -114,7 +148,8 @@ void PrimeInventory::primeSystemBlueprint() const noexcept
             // Prime the inventry for FRUs
             for (const auto& l_Fru : m_sysCfgJsonObj["frus"][l_vpdFilePath])
             {
-                if (!primeInventory(l_objectInterfaceMap, l_Fru))
+                if (!primeInventory(l_objectInterfaceMap, l_Fru, l_pimObjects,
+                                    l_isChassisPowerOn))
                 {
                     m_logger->logMessage(
                         "Priming of inventory failed for FRU " +
@@ -146,7 +181,9 @@ void PrimeInventory::primeSystemBlueprint() const noexcept
 
 bool PrimeInventory::primeInventory(
     vpd::types::ObjectMap& o_objectInterfaceMap,
-    const nlohmann::json& i_fruJsonObj) const noexcept
+    const nlohmann::json& i_fruJsonObj,
+    const vpd::types::ObjectMap& i_pimObjects,
+    bool i_isChassisPowerOn) const noexcept
 {
     if (i_fruJsonObj.empty())
     {
@@ -169,6 +206,13 @@ bool PrimeInventory::primeInventory(
         return true;
     }
 
+    // FRU's existing data under PIM, empty if FRU is not yet under PIM.
+    static const vpd::types::InterfaceMap l_emptyInterfaceMap;
+    const auto l_itrToPimObject = i_pimObjects.find(l_fruObjectPath);
+    const vpd::types::InterfaceMap& l_pimInterfaceMap =
+        (l_itrToPimObject != i_pimObjects.end()) ? l_itrToPimObject->second
+                                                 : l_emptyInterfaceMap;
+
     // Reset data under PIM for this FRU only if the FRU is not synthesized
     // and we handle it's Present property.
     if (isPresentPropertyHandlingRequired(i_fruJsonObj))
@@ -176,7 +220,7 @@ bool PrimeInventory::primeInventory(
         // Clear data under PIM if already exists.
         uint16_t l_errCode = 0;
         vpd::vpdSpecificUtility::resetDataUnderPIM(
-            std::string(i_fruJsonObj["inventoryPath"]), l_interfaces,
+            l_pimInterfaceMap, l_interfaces,
             i_fruJsonObj.value("handlePresence", true), l_errCode);
 
         if (l_errCode)
@@ -232,8 +276,13 @@ bool PrimeInventory::primeInventory(
                            std::monostate{});
     }
 
-    processFunctionalProperty(i_fruJsonObj["inventoryPath"], l_interfaces);
-    processEnabledProperty(i_fruJsonObj["inventoryPath"], l_interfaces);
+    // If chassis is power on, Functional and Enabled properties should be
+    // there on D-Bus. Don't process.
+    if (!i_isChassisPowerOn)
+    {
+        processFunctionalProperty(l_pimInterfaceMap, l_interfaces);
+        processEnabledProperty(l_pimInterfaceMap, l_interfaces);
+    }
 
     // Emplace the default state of FRU VPD collection
     vpd::types::PropertyMap l_fruCollectionProperty = {
@@ -445,96 +494,55 @@ void PrimeInventory::populateInterfaces(
 }
 
 void PrimeInventory::processFunctionalProperty(
-    const std::string& i_inventoryObjPath,
+    const vpd::types::InterfaceMap& i_pimInterfaceMap,
     vpd::types::InterfaceMap& io_interfaces) const noexcept
 {
-    if (!vpd::dbusUtility::isChassisPowerOn())
+    if (i_pimInterfaceMap.contains(vpd::constants::operationalStatusInf))
     {
-        std::vector<std::string> l_operationalStatusInf{
-            vpd::constants::operationalStatusInf};
-
-        auto l_mapperObjectMap = vpd::dbusUtility::getObjectMap(
-            i_inventoryObjPath, l_operationalStatusInf);
-
-        // If the object has been found. Check if it is under PIM.
-        if (l_mapperObjectMap.size() != 0)
-        {
-            for (const auto& [l_serviceName, l_interfaceLsit] :
-                 l_mapperObjectMap)
-            {
-                if (l_serviceName == vpd::constants::pimServiceName)
-                {
-                    // The object is already under PIM. No need to process
-                    // again. Retain the old value.
-                    return;
-                }
-            }
-        }
+        // The object is already under PIM. No need to process again. Retain
+        // the old value.
+        return;
+    }
 
-        // Implies value is not there in D-Bus. Populate it with default
-        // value "true".
-        uint16_t l_errCode = 0;
-        vpd::types::PropertyMap l_functionalProp;
-        l_functionalProp.emplace("Functional", true);
-        vpd::vpdSpecificUtility::insertOrMerge(
-            io_interfaces, vpd::constants::operationalStatusInf,
-            move(l_functionalProp), l_errCode);
+    // Implies value is not there in D-Bus. Populate it with default value
+    // "true".
+    uint16_t l_errCode = 0;
+    vpd::types::PropertyMap l_functionalProp;
+    l_functionalProp.emplace("Functional", true);
+    vpd::vpdSpecificUtility::insertOrMerge(
+        io_interfaces, vpd::constants::operationalStatusInf,
+        move(l_functionalProp), l_errCode);
 
-        if (l_errCode)
-        {
-            m_logger->logMessage("Failed to insert value into map, error : " +
-                                 vpd::commonUtility::getErrCodeMsg(l_errCode));
-        }
+    if (l_errCode)
+    {
+        m_logger->logMessage("Failed to insert value into map, error : " +
+                             vpd::commonUtility::getErrCodeMsg(l_errCode));
     }
-
-    // if chassis is power on. Functional property should be there on D-Bus.
-    // Don't process.
-    return;
 }
 
 void PrimeInventory::processEnabledProperty(
-    const std::string& i_inventoryObjPath,
+    const vpd::types::InterfaceMap& i_pimInterfaceMap,
     vpd::types::InterfaceMap& io_interfaces) const noexcept
 {
-    if (!vpd::dbusUtility::isChassisPowerOn())
+    if (i_pimInterfaceMap.contains(vpd::constants::enableInf))
     {
-        std::vector<std::string> l_enableInf{vpd::constants::enableInf};
-
-        auto l_mapperObjectMap =
-            vpd::dbusUtility::getObjectMap(i_inventoryObjPath, l_enableInf);
-
-        // If the object has been found. Check if it is under PIM.
-        if (l_mapperObjectMap.size() != 0)
-        {
-            for (const auto& [l_serviceName, l_interfaceLsit] :
-                 l_mapperObjectMap)
-            {
-                if (l_serviceName == vpd::constants::pimServiceName)
-                {
-                    // The object is already under PIM. No need to process
-                    // again. Retain the old value.
-                    return;
-                }
-            }
-        }
+        // The object is already under PIM. No need to process again. Retain
+        // the old value.
+        return;
+    }
 
-        // Implies value is not there in D-Bus. Populate it with default
-        // value "true".
-        uint16_t l_errCode = 0;
-        vpd::types::PropertyMap l_enabledProp;
-        l_enabledProp.emplace("Enabled", true);
-        vpd::vpdSpecificUtility::insertOrMerge(
-            io_interfaces, vpd::constants::enableInf, move(l_enabledProp),
-            l_errCode);
+    // Implies value is not there in D-Bus. Populate it with default value
+    // "true".
+    uint16_t l_errCode = 0;
+    vpd::types::PropertyMap l_enabledProp;
+    l_enabledProp.emplace("Enabled", true);
+    vpd::vpdSpecificUtility::insertOrMerge(io_interfaces,
+                                           vpd::constants::enableInf,
+                                           move(l_enabledProp), l_errCode);
 
-        if (l_errCode)
-        {
-            m_logger->logMessage("Failed to insert value into map, error : " +
-                                 vpd::commonUtility::getErrCodeMsg(l_errCode));
-        }
+    if (l_errCode)
+    {
+        m_logger->logMessage("Failed to insert value into map, error : " +
+                             vpd::commonUtility::getErrCodeMsg(l_errCode));
     }
-
-    // if chassis is power on. Enabled property should be there on D-Bus.
-    // Don't process.
-    return;
 }
@@ -9,20 +9,35 @@
 
 #include <CLI/CLI.hpp>
 
+#include <algorithm>
 #include <chrono>
-#include <thread>
+
+/**
+ * @brief API to check if VPD collection is completed.
+ *
+ * @param[in] i_status - Value of collection "Status" property.
+ *
+ * @return true if collection is completed, false otherwise.
+ */
+inline bool isVpdCollectionCompleted(
+    const vpd::types::DbusVariantType& i_status) noexcept
+{
+    const auto l_val = std::get_if<std::string>(&i_status);
+    return l_val && *l_val == vpd::constants::vpdCollectionCompleted;
+}
 
 /**
  * @brief API to check for VPD collection status
  *
- * This API checks for VPD manager collection status by reading the
- * collection "Status" property exposed by vpd-manager on Dbus. The read logic
- * uses a retry loop with a specific number of retries with specific sleep time
- * between each retry.
+ * This API waits for VPD manager collection to complete, by listening to
+ * change of the collection "Status" property exposed by vpd-manager on Dbus.
+ * The property is also read once the listener is in place, and then on every
+ * retry interval with no change received, in case vpd-manager was not yet
+ * up. The wait is bounded by the retry limit times the retry interval, the
+ * property is read at least once even if the bound is zero.
  *
  * @param[in] i_retryLimit - Maximum number of retries
- * @param[in] i_sleepDurationInSeconds - Sleep time in seconds between each
- * retry
+ * @param[in] i_sleepDurationInSeconds - Time in seconds between each retry
  *
  * @return If "CollectionStatus" property is "Completed", returns 0, otherwise
  * returns 1.
@@ -34,37 +49,84 @@ int checkVpdCollectionStatus(const unsigned i_retryLimit,
 
     try
     {
+        const std::chrono::seconds l_retryInterval{i_sleepDurationInSeconds};
+        const auto l_deadline =
+            std::chrono::steady_clock::now() + l_retryInterval * i_retryLimit;
+
         l_logger->logMessage(
-            "Checking every " + std::to_string(i_sleepDurationInSeconds) +
+            "Waiting up to " +
+            std::to_string(i_retryLimit * i_sleepDurationInSeconds) +
             "s for VPD collection status ....");
 
-        for (unsigned l_retries = i_retryLimit;
-             l_retries != vpd::constants::VALUE_0; --l_retries)
-        {
-            // check at specified time interval
-            std::this_thread::sleep_for(
-                std::chrono::seconds(i_sleepDurationInSeconds));
+        auto& l_bus = vpd::dbusUtility::getBus();
+        bool l_isCollectionCompleted{false};
+
+        // Listen to the property before reading it, so that no change is
+        // missed in between.
+        sdbusplus::bus::match_t l_statusMatch(
+            l_bus,
+            sdbusplus::bus::match::rules::propertiesChanged(
+                OBJPATH, vpd::constants::vpdCollectionInterface),
+            [&l_isCollectionCompleted, &l_logger](sdbusplus::message_t& i_msg) {
+                try
+                {
+                    std::string l_interface;
+                    vpd::types::PropertyMap l_propMap;
+                    i_msg.read(l_interface, l_propMap);
 
-            const auto l_propValue = vpd::dbusUtility::readDbusProperty(
-                IFACE, OBJPATH, vpd::constants::vpdCollectionInterface,
-                "Status");
+                    const auto l_itr = l_propMap.find("Status");
+                    if (l_itr != l_propMap.end() &&
+                        isVpdCollectionCompleted(l_itr->second))
+                    {
+                        l_isCollectionCompleted = true;
+                    }
+                }
+                catch (const std::exception& l_ex)
+                {
+                    // Status is read again on the next retry interval.
+                    l_logger->logMessage(
+                        "Failed to read collection status change, error: " +
+                        std::string(l_ex.what()));
+                }
+            });
 
-            if (auto l_val = std::get_if<std::string>(&l_propValue))
+        auto l_nextRead = std::chrono::steady_clock::now();
+        while (!l_isCollectionCompleted)
+        {
+            // Read is due before the deadline is checked, so that the status
+            // is read at least once.
+            const auto l_now = std::chrono::steady_clock::now();
+            if (l_now >= l_nextRead)
             {
-                if (*l_val == vpd::constants::vpdCollectionCompleted)
+                l_isCollectionCompleted = isVpdCollectionCompleted(
+                    vpd::dbusUtility::readDbusProperty(
+                        IFACE, OBJPATH, vpd::constants::vpdCollectionInterface,
+                        "Status"));
+                l_nextRead = l_now + l_retryInterval;
+
+                if (l_isCollectionCompleted)
                 {
-                    l_logger->logMessage("VPD collection is completed");
-                    return vpd::constants::VALUE_0;
+                    break;
                 }
             }
 
-            l_logger->logMessage(
-                "Waiting for VPD status update. Retries remaining: " +
-                std::to_string(l_retries));
+            if (l_now >= l_deadline)
+            {
+                l_logger->logMessage(
+                    "Exit wait for VPD services to finish with timeout");
+                return vpd::constants::VALUE_1;
+            }
+
+            // Block till a message is received or till next read is due.
+            l_bus.wait(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::min(l_nextRead, l_deadline) - l_now));
+
+            while (l_bus.process_discard())
+            {}
         }
 
-        l_logger->logMessage(
-            "Exit wait for VPD services to finish with timeout");
+        l_logger->logMessage("VPD collection is completed");
+        return vpd::constants::VALUE_0;
     }
     catch (const std::exception& l_ex)
     {
@@ -88,7 +150,7 @@ inline bool collectAllFruVpd() noexcept
     bool l_rc{true};
     try
     {
-        auto l_bus = sdbusplus::bus::new_default();
+        auto& l_bus = vpd::dbusUtility::getBus();
         auto l_method =
             l_bus.new_method_call(IFACE, OBJPATH, IFACE, "CollectAllFRUVPD");
 
@@ -111,7 +173,8 @@ inline bool collectAllFruVpd() noexcept
  * This API handles inventory backup data. It checks if there is any inventory
  * backup data and restores it if so. It also restarts the inventory manager
  * service so that the restored data is reflected on D-Bus, and then clears the
- * backup data.
+ * backup data. If the restart fails, a critical PEL is logged and FRU VPD
+ * collection is left to publish the VPD, provided the service still runs.
  *
  * @return true if inventory backup data is found and restored successfully, and
  * inventory manager service is successfully restarted. It returns false if
@@ -132,6 +195,13 @@ bool checkAndHandleInventoryBackup()
 
     if (!l_inventoryBackupHandler.restoreInventoryBackupData(l_errCode))
     {
+        // Failed restore left the service stopped, neither restored data nor
+        // FRU VPD collection can be published.
+        if (l_errCode == vpd::error_code::SERVICE_NOT_RUNNING)
+        {
+            throw std::runtime_error(
+                "Inventory manager service is not running after failed restore of inventory backup data");
+        }
         return l_rc;
     }
 
@@ -149,9 +219,27 @@ bool checkAndHandleInventoryBackup()
     }
     else
     {
-        // TODO: Restarting the inventory manager service has failed,
-        // check error code to determine whether to go for VPD
-        //  collection or to fail this service
+        const vpd::types::PelInfoTuple l_pelInfo{
+            vpd::types::ErrorType::FirmwareError,
+            vpd::types::SeverityType::Critical,
+            0,
+            std::nullopt,
+            std::nullopt,
+            std::nullopt,
+            std::nullopt};
+
+        l_logger->logMessage(
+            "Failed to restart inventory manager service after restoring inventory backup data",
+            vpd::PlaceHolder::PEL, &l_pelInfo);
+
+        // Restored data is not on D-Bus. If the service still runs, FRU VPD
+        // collection publishes the VPD instead, else nothing can be done here.
+        if (!l_inventoryBackupHandler.isInventoryManagerServiceActive(
+                l_errCode))
+        {
+            throw std::runtime_error(
+                "Inventory manager service is not running");
+        }
     }
     return l_rc;
 }
@@ -169,7 +257,7 @@ int main(int argc, char** argv)
         l_app.add_option("--retryLimit, -r", l_retryLimit, "Retry limit");
         l_app.add_option("--sleepDurationInSeconds, -s",
                          l_sleepDurationInSeconds,
-                         "Sleep duration in seconds between each retry");
+                         "Time in seconds between each retry");
 
         CLI11_PARSE(l_app, argc, argv);
 